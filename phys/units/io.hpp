@@ -19,6 +19,7 @@
 #include "phys/units/quantity_io.hpp"
 #include "phys/units/quantity_io_engineering.hpp"
 #include "phys/units/quantity_io_symbols.hpp"
+#include "phys/units/quantity_io_instantiate.hpp"
 
 #endif // PHYS_UNITS_IO_HPP_INCLUDED
 
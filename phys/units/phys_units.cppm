@@ -0,0 +1,58 @@
+/**
+ * \file phys_units.cppm
+ *
+ * \brief   C++20 module interface phys.units for quantity library.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Exports quantity.hpp, other_units.hpp, physical_constants.hpp and io.hpp:
+ *
+ *    import phys.units;
+ *
+ *    using namespace phys::units;
+ *    using namespace phys::units::io;
+ *
+ * The standard headers are included in the global module fragment, the
+ * library headers in the module purview. The using-directive of quantity.hpp
+ * that makes ct::phys available as phys is not exported; the namespace alias
+ * below is. The configuration macros (PHYS_UNITS_REP_TYPE, ...) must be set
+ * when compiling this interface, for example with GNU C++:
+ *
+ *    g++ -std=c++20 -fmodules-ts -I../.. -x c++ -c phys_units.cppm
+ *
+ * See projects/Time/Makefile.win32.gcc, target build-time, for a comparison
+ * with plain includes and a precompiled header.
+ */
+
+module;
+
+#include <cmath>
+#include <iomanip>
+#include <iosfwd>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+export module phys.units;
+
+export {
+#include "phys/units/quantity.hpp"
+#include "phys/units/other_units.hpp"
+#include "phys/units/physical_constants.hpp"
+#include "phys/units/io.hpp"
+}
+
+#ifndef PHYS_UNITS_IN_CT_NAMESPACE
+export namespace phys = ct::phys;
+#endif
+
+/*
+ * end of file
+ */
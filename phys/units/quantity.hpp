@@ -86,7 +86,7 @@
 #ifndef PHYS_UNITS_QUANTITY_HPP_INCLUDED
 #define PHYS_UNITS_QUANTITY_HPP_INCLUDED
 
-#include <cmath>  // for pow()
+#include <cmath>  // for pow(), fma(), hypot()
 
 #if defined( __GNUC__ )
    #define PHYS_UNITS_COMPILER_IS_GNUC
@@ -102,6 +102,29 @@
    #endif
 #endif
 
+#if ( __cplusplus >= 201103L ) || ( defined( _MSC_VER ) && ( _MSC_VER >= 1900 ) )
+   #define PHYS_UNITS_CPP11_OR_GREATER
+#endif
+
+#if ( __cplusplus >= 201703L ) || ( defined( _MSVC_LANG ) && ( _MSVC_LANG >= 201703L ) )
+   #define PHYS_UNITS_CPP17_OR_GREATER
+#endif
+
+#if ( __cplusplus >= 202002L ) || ( defined( _MSVC_LANG ) && ( _MSVC_LANG >= 202002L ) )
+   #define PHYS_UNITS_CPP20_OR_GREATER
+#endif
+
+// constexpr for the quantity constructors, base units and prefixes; define
+// PHYS_UNITS_CONSTEXPR empty for a PHYS_UNITS_REP_TYPE that is not a literal type.
+
+#ifndef PHYS_UNITS_CONSTEXPR
+   #ifdef PHYS_UNITS_CPP11_OR_GREATER
+      #define PHYS_UNITS_CONSTEXPR constexpr
+   #else
+      #define PHYS_UNITS_CONSTEXPR
+   #endif
+#endif
+
 #ifdef PHYS_UNITS_COMPILER_IS_MSVC
    // for MSVC, 4248 = invalid access to "private" - must be treated as an error
    // for MSVC, 4786 = truncated names in debugger - ignore
@@ -172,6 +195,42 @@ namespace ct { namespace phys { namespace units {
 template< typename Dims, typename T = Rep >
 class quantity;
 
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+namespace detail {
+
+/**
+ * dimension exponents packed into one integer, eight bits each, D1 lowest.
+ */
+template< int D1, int D2, int D3, int D4, int D5, int D6, int D7 >
+struct dimension_pack
+{
+   static_assert(
+      -128 <= D1 && D1 < 128 && -128 <= D2 && D2 < 128 && -128 <= D3 && D3 < 128 &&
+      -128 <= D4 && D4 < 128 && -128 <= D5 && D5 < 128 && -128 <= D6 && D6 < 128 &&
+      -128 <= D7 && D7 < 128, "dimension exponents must be in the range -128..127" );
+
+   enum : long long
+   {
+      value = D1 + 256LL * ( D2 + 256LL * ( D3 + 256LL * ( D4 + 256LL * ( D5 + 256LL * ( D6 + 256LL * D7 ) ) ) ) )
+   };
+};
+
+/**
+ * exponent i of a packed dimension code.
+ */
+constexpr int dimension_unpack( long long code, int i )
+{
+   return i == 0 ? static_cast<int>( ( code % 256 + 384 ) % 256 - 128 )
+                 : dimension_unpack( ( code - dimension_unpack( code, 0 ) ) / 256, i - 1 );
+}
+
+} // namespace detail
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+#ifndef PHYS_UNITS_PACKED_DIMENSIONS
+
 /**
  * We could drag dimensions around individually, but it's much more convenient to package them.
  */
@@ -209,6 +268,106 @@ struct dimensions
    }
 };
 
+#else // PHYS_UNITS_PACKED_DIMENSIONS
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+   #error PHYS_UNITS_PACKED_DIMENSIONS requires C++11 or later
+#endif
+
+/**
+ * dimensions as a single packed code, for short symbol names and debug
+ * information; dimensions<...> below names these, so that typedefs like
+ * length_d and code that uses Dims::dim1 etc. remain unchanged.
+ */
+template< long long Code >
+struct packed_dimensions
+{
+   enum
+   {
+      dim1 = detail::dimension_unpack( Code, 0 ),
+      dim2 = detail::dimension_unpack( Code, 1 ),
+      dim3 = detail::dimension_unpack( Code, 2 ),
+      dim4 = detail::dimension_unpack( Code, 3 ),
+      dim5 = detail::dimension_unpack( Code, 4 ),
+      dim6 = detail::dimension_unpack( Code, 5 ),
+      dim7 = detail::dimension_unpack( Code, 6 ),
+
+      is_all_zero = Code == 0,
+
+      is_base =
+         1 == (dim1 != 0) + (dim2 != 0) + (dim3 != 0) + (dim4 != 0) + (dim5 != 0) + (dim6 != 0) + (dim7 != 0)  &&
+         1 ==  dim1 + dim2 + dim3 + dim4 + dim5 + dim6 + dim7,
+   };
+
+   template< long long R >
+   bool operator==( packed_dimensions<R> const & rhs ) const
+   {
+      return Code == R;
+   }
+
+   template< long long R >
+   bool operator!=( packed_dimensions<R> const & rhs ) const
+   {
+      return Code != R;
+   }
+};
+
+/**
+ * With PHYS_UNITS_PACKED_DIMENSIONS, dimensions<...> is packed_dimensions< code >.
+ */
+template< int D1, int D2, int D3, int D4 = 0, int D5 = 0, int D6 = 0, int D7 = 0 >
+using dimensions = packed_dimensions< detail::dimension_pack< D1, D2, D3, D4, D5, D6, D7 >::value >;
+
+#endif // PHYS_UNITS_PACKED_DIMENSIONS
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+/**
+ * dimensions as one integer, see detail::dimension_pack; equal for equal dimensions.
+ */
+template< typename Dims >
+struct dimension_code
+{
+   enum : long long
+   {
+      value = detail::dimension_pack<
+         Dims::dim1, Dims::dim2, Dims::dim3, Dims::dim4, Dims::dim5, Dims::dim6, Dims::dim7 >::value
+   };
+};
+
+/**
+ * list of dimensions, such as one per row or column of a quantity_matrix.
+ */
+template< typename... Dims >
+struct dimension_list
+{
+   enum { size = sizeof...( Dims ) };
+};
+
+namespace detail {
+
+/**
+ * I-th dimensions of a dimension_list.
+ */
+template< int I, typename List >
+struct list_at;
+
+template< typename Head, typename... Tail >
+struct list_at< 0, dimension_list< Head, Tail... > >
+{
+   typedef Head type;
+};
+
+template< int I, typename Head, typename... Tail >
+struct list_at< I, dimension_list< Head, Tail... > >
+{
+   typedef typename list_at< I - 1, dimension_list< Tail... > >::type type;
+};
+
+} // namespace detail
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
 typedef dimensions< 0, 0, 0 > dimensionless_d;
 
 /**
@@ -238,6 +397,25 @@ template<int> struct CompileTimeError {};
  */
 template<> struct CompileTimeError<true> { typedef char type; };
 
+/**
+ * true if both dimensions are the same.
+ */
+template< typename LhsDims, typename RhsDims >
+struct equal_dimensions
+{
+   enum
+   {
+      value =
+         LhsDims::dim1 == RhsDims::dim1 &&
+         LhsDims::dim2 == RhsDims::dim2 &&
+         LhsDims::dim3 == RhsDims::dim3 &&
+         LhsDims::dim4 == RhsDims::dim4 &&
+         LhsDims::dim5 == RhsDims::dim5 &&
+         LhsDims::dim6 == RhsDims::dim6 &&
+         LhsDims::dim7 == RhsDims::dim7
+   };
+};
+
 /**
  * \brief The "permit" class is a portability hack - anyone with a permit
  * is treated as a friend w.r.t. access to the constructor and
@@ -248,18 +426,19 @@ struct permit
 {
    typedef T value_type;
 
-   permit()
+   PHYS_UNITS_CONSTEXPR permit()
+   : m_value()
    {
    }
 
-   explicit permit( value_type const & v )
+   explicit PHYS_UNITS_CONSTEXPR permit( value_type const & v )
    : m_value( v )
    {
    }
 
    // needed so we can construct primitives from it:
 
-   operator value_type() const
+   PHYS_UNITS_CONSTEXPR operator value_type() const
    {
       return m_value;
    }
@@ -366,7 +545,9 @@ struct product
       d7 = LhsDims::dim7 + RhsDims::dim7,
    };
 
-   typedef typename collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T >::type type;
+   typedef dimensions< d1, d2, d3, d4, d5, d6, d7 > dimension_type;
+
+   typedef typename collapse< dimension_type, T >::type type;
 };
 
 /**
@@ -386,7 +567,9 @@ struct quotient
       d7 = LhsDims::dim7 - RhsDims::dim7,
    };
 
-   typedef typename collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T >::type type;
+   typedef dimensions< d1, d2, d3, d4, d5, d6, d7 > dimension_type;
+
+   typedef typename collapse< dimension_type, T >::type type;
 };
 
 /**
@@ -406,7 +589,9 @@ struct reciprocal
       d7 = - Dims::dim7,
    };
 
-   typedef typename collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T >::type type;
+   typedef dimensions< d1, d2, d3, d4, d5, d6, d7 > dimension_type;
+
+   typedef typename collapse< dimension_type, T >::type type;
 };
 
 /**
@@ -425,7 +610,9 @@ struct power
       d7 = N * Dims::dim7,
    };
 
-   typedef typename collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T >::type type;
+   typedef dimensions< d1, d2, d3, d4, d5, d6, d7 > dimension_type;
+
+   typedef typename collapse< dimension_type, T >::type type;
 };
 
 /**
@@ -457,7 +644,9 @@ struct root
       d7 = Dims::dim7 / N
    };
 
-   typedef typename collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T >::type type;
+   typedef dimensions< d1, d2, d3, d4, d5, d6, d7 > dimension_type;
+
+   typedef typename collapse< dimension_type, T >::type type;
 };
 
 } // namespace detail
@@ -584,7 +773,7 @@ public:
     * should really just be declared as friends and refer directly to the
     * private members.
     */
-   explicit quantity( detail::permit< value_type > const & p )
+   explicit PHYS_UNITS_CONSTEXPR quantity( detail::permit< value_type > const & p )
    : m_value( p.m_value )
    {
    }
@@ -600,7 +789,7 @@ public:
    /**
     * permit access to value (const).
     */
-   const value_type & get( detail::permit< value_type > const & ) const
+   PHYS_UNITS_CONSTEXPR const value_type & get( detail::permit< value_type > const & ) const
    {
       return m_value;
    }
@@ -609,7 +798,7 @@ private:
    /**
     * private initializing constructor.
     */
-   explicit quantity( value_type val )
+   explicit PHYS_UNITS_CONSTEXPR quantity( value_type val )
    : m_value( val )
    {
    }
@@ -621,6 +810,37 @@ private:
    PHYS_UNITS_STATIC_ASSERT_TYPE( ok, quantity_dimensions_must_not_all_be_zero );
 };
 
+namespace detail {
+
+/**
+ * representation value of a quantity.
+ */
+template< typename Dims, typename T >
+inline T value_of( quantity< Dims, T > const & q )
+{
+   return q.get( permit<T>() );
+}
+
+/**
+ * representation value of a dimensionless (collapsed) result.
+ */
+template< typename T >
+inline T value_of( T const & v )
+{
+   return v;
+}
+
+/**
+ * quantity, or representation value if dimensionless, from representation value.
+ */
+template< typename Dims, typename T >
+inline typename collapse< Dims, T >::type from_value( T const & v )
+{
+   return TYPENAME_TYPE_K collapse< Dims, T >::type( permit<T>( v ) );
+}
+
+} // namespace detail
+
 // Give names to the seven fundamental dimensions of physical reality.
 
 typedef dimensions< 1, 0, 0, 0, 0, 0, 0 > length_d;
@@ -874,13 +1094,130 @@ sqrt( quantity< Dims, T > const & rhs )
    );
 }
 
+// Fused and overflow-safe operations
+
+namespace detail {
+
+/**
+ * x * y + z, rounded once if the platform provides fma().
+ */
+template< typename T >
+inline T fma_( T const x, T const y, T const z )
+{
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+   using std::fma;
+   return fma( x, y, z );
+#else
+   return x * y + z;
+#endif
+}
+
+/**
+ * sqrt( x * x + y * y ) without undue overflow or underflow.
+ */
+template< typename T >
+inline T hypot_( T const x, T const y )
+{
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+   using std::hypot;
+   return hypot( x, y );
+#else
+   using std::fabs;
+   using std::sqrt;
+
+   T const ax = fabs( x );
+   T const ay = fabs( y );
+   T const hi = ax < ay ? ay : ax;
+   T const lo = ax < ay ? ax : ay;
+
+   if ( hi == T( 0 ) )
+   {
+      return hi;
+   }
+
+   T const r = lo / hi;
+   return T( hi * sqrt( T( 1 ) + r * r ) );
+#endif
+}
+
+/**
+ * sqrt( x * x + y * y + z * z ) without undue overflow or underflow.
+ */
+template< typename T >
+inline T hypot_( T const x, T const y, T const z )
+{
+#ifdef PHYS_UNITS_CPP17_OR_GREATER
+   using std::hypot;
+   return hypot( x, y, z );
+#else
+   return hypot_( hypot_( x, y ), z );
+#endif
+}
+
+} // namespace detail
+
+/**
+ * fused multiply-add, x * y + z; z must have the dimensions of x * y.
+ */
+template< typename XDims, typename YDims, typename ZDims, typename X, typename Y, typename Z >
+inline quantity< ZDims, PHYS_UNITS_PROMOTE( PHYS_UNITS_PROMOTE(X,Y), Z ) >
+fma( quantity< XDims, X > const & x, quantity< YDims, Y > const & y, quantity< ZDims, Z > const & z )
+{
+   typedef PHYS_UNITS_PROMOTE( PHYS_UNITS_PROMOTE(X,Y), Z ) result_value_type;
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+   static_assert(
+      (detail::equal_dimensions< TYPENAME_TYPE_K detail::product< XDims, YDims, Rep >::dimension_type, ZDims >::value),
+      "fma addend must have the dimensions of the product" );
+#else
+   PHYS_UNITS_STATIC_ASSERT_TYPE(
+      (detail::equal_dimensions< TYPENAME_TYPE_K detail::product< XDims, YDims, Rep >::dimension_type, ZDims >::value),
+      fma_addend_must_have_dimensions_of_product );
+   (void) sizeof( ERROR__fma_addend_must_have_dimensions_of_product );
+#endif
+
+   return quantity< ZDims, result_value_type >( detail::permit< result_value_type >(
+      detail::fma_< result_value_type >(
+         x.get( detail::permit<X>() ), y.get( detail::permit<Y>() ), z.get( detail::permit<Z>() ) ) )
+   );
+}
+
+/**
+ * hypotenuse, sqrt( x * x + y * y ), without undue overflow or underflow.
+ */
+template< typename Dims, typename X, typename Y >
+inline quantity< Dims, PHYS_UNITS_PROMOTE(X,Y) >
+hypot( quantity< Dims, X > const & x, quantity< Dims, Y > const & y )
+{
+   typedef PHYS_UNITS_PROMOTE(X,Y) result_value_type;
+
+   return quantity< Dims, result_value_type >( detail::permit< result_value_type >(
+      detail::hypot_< result_value_type >( x.get( detail::permit<X>() ), y.get( detail::permit<Y>() ) ) )
+   );
+}
+
+/**
+ * three-dimensional hypotenuse, sqrt( x * x + y * y + z * z ).
+ */
+template< typename Dims, typename X, typename Y, typename Z >
+inline quantity< Dims, PHYS_UNITS_PROMOTE( PHYS_UNITS_PROMOTE(X,Y), Z ) >
+hypot( quantity< Dims, X > const & x, quantity< Dims, Y > const & y, quantity< Dims, Z > const & z )
+{
+   typedef PHYS_UNITS_PROMOTE( PHYS_UNITS_PROMOTE(X,Y), Z ) result_value_type;
+
+   return quantity< Dims, result_value_type >( detail::permit< result_value_type >(
+      detail::hypot_< result_value_type >(
+         x.get( detail::permit<X>() ), y.get( detail::permit<Y>() ), z.get( detail::permit<Z>() ) ) )
+   );
+}
+
 // Comparison operators
 
 /**
  * equality.
  */
 template< typename Dims, typename X, typename Y >
-inline bool operator==( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
+inline PHYS_UNITS_CONSTEXPR bool operator==( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
 {
    return lhs.get( detail::permit<X>() ) == rhs.get( detail::permit<Y>() );
 }
@@ -889,7 +1226,7 @@ inline bool operator==( quantity< Dims, X > const & lhs, quantity< Dims, Y > con
  * inequality.
  */
 template< typename Dims, typename X, typename Y >
-inline bool operator!=( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
+inline PHYS_UNITS_CONSTEXPR bool operator!=( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
 {
    return lhs.get( detail::permit<X>() ) != rhs.get( detail::permit<Y>() );
 }
@@ -898,7 +1235,7 @@ inline bool operator!=( quantity< Dims, X > const & lhs, quantity< Dims, Y > con
  * less-equal.
  */
 template< typename Dims, typename X, typename Y >
-inline bool operator<=( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
+inline PHYS_UNITS_CONSTEXPR bool operator<=( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
 {
    return lhs.get( detail::permit<X>() ) <= rhs.get( detail::permit<Y>() );
 }
@@ -907,7 +1244,7 @@ inline bool operator<=( quantity< Dims, X > const & lhs, quantity< Dims, Y > con
  * greater-equal.
  */
 template< typename Dims, typename X, typename Y >
-inline bool operator>=( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
+inline PHYS_UNITS_CONSTEXPR bool operator>=( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
 {
    return lhs.get( detail::permit<X>() ) >= rhs.get( detail::permit<Y>() );
 }
@@ -916,7 +1253,7 @@ inline bool operator>=( quantity< Dims, X > const & lhs, quantity< Dims, Y > con
  * less-than.
  */
 template< typename Dims, typename X, typename Y >
-inline bool operator<( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
+inline PHYS_UNITS_CONSTEXPR bool operator<( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
 {
    return lhs.get( detail::permit<X>() ) < rhs.get( detail::permit<Y>() );
 }
@@ -925,81 +1262,81 @@ inline bool operator<( quantity< Dims, X > const & lhs, quantity< Dims, Y > cons
  * greater-than.
  */
 template< typename Dims, typename X, typename Y >
-inline bool operator>( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
+inline PHYS_UNITS_CONSTEXPR bool operator>( quantity< Dims, X > const & lhs, quantity< Dims, Y > const & rhs )
 {
    return lhs.get( detail::permit<X>() ) > rhs.get( detail::permit<Y>() );
 }
 
 // The seven SI base units.  These tie our numbers to the real world.
 
-inline quantity< length_d > meter()
+inline PHYS_UNITS_CONSTEXPR quantity< length_d > meter()
 {
    return quantity< length_d >( detail::permit<Rep>( 1.0 ) );
 }
 
-inline quantity< mass_d > kilogram()
+inline PHYS_UNITS_CONSTEXPR quantity< mass_d > kilogram()
 {
    return quantity< mass_d >( detail::permit<Rep>( 1.0 ) );
 }
 
-inline quantity< time_interval_d > second()
+inline PHYS_UNITS_CONSTEXPR quantity< time_interval_d > second()
 {
    return quantity< time_interval_d >( detail::permit<Rep>( 1.0 ) );
 }
 
-inline quantity< electric_current_d > ampere()
+inline PHYS_UNITS_CONSTEXPR quantity< electric_current_d > ampere()
 {
    return quantity< electric_current_d >( detail::permit<Rep>( 1.0 ) );
 }
 
-inline quantity< thermodynamic_temperature_d > kelvin()
+inline PHYS_UNITS_CONSTEXPR quantity< thermodynamic_temperature_d > kelvin()
 {
    return quantity< thermodynamic_temperature_d >( detail::permit<Rep>( 1.0 ) );
 }
 
-inline quantity< amount_of_substance_d > mole()
+inline PHYS_UNITS_CONSTEXPR quantity< amount_of_substance_d > mole()
 {
    return quantity< amount_of_substance_d >( detail::permit<Rep>( 1.0 ) );
 }
 
-inline quantity< luminous_intensity_d > candela()
+inline PHYS_UNITS_CONSTEXPR quantity< luminous_intensity_d > candela()
 {
    return quantity< luminous_intensity_d >( detail::permit<Rep>( 1.0 ) );
 }
 
 // The standard SI prefixes.
 
-inline Rep yotta()   { return Rep( 1e+24L ); }
-inline Rep zetta()   { return Rep( 1e+21L ); }
-inline Rep exa()     { return Rep( 1e+18L ); }
-inline Rep peta()    { return Rep( 1e+15L ); }
-inline Rep tera()    { return Rep( 1e+12L ); }
-inline Rep giga()    { return Rep( 1e+9L ); }
-inline Rep mega()    { return Rep( 1e+6L ); }
-inline Rep kilo()    { return Rep( 1e+3L ); }
-inline Rep hecto()   { return Rep( 1e+2L ); }
-inline Rep deka()    { return Rep( 1e+1L ); }
-inline Rep deci()    { return Rep( 1e-1L ); }
-inline Rep centi()   { return Rep( 1e-2L ); }
-inline Rep milli()   { return Rep( 1e-3L ); }
-inline Rep micro()   { return Rep( 1e-6L ); }
-inline Rep nano()    { return Rep( 1e-9L ); }
-inline Rep pico()    { return Rep( 1e-12L ); }
-inline Rep femto()   { return Rep( 1e-15L ); }
-inline Rep atto()    { return Rep( 1e-18L ); }
-inline Rep zepto()   { return Rep( 1e-21L ); }
-inline Rep yocto()   { return Rep( 1e-24L ); }
+inline PHYS_UNITS_CONSTEXPR Rep yotta()   { return Rep( 1e+24L ); }
+inline PHYS_UNITS_CONSTEXPR Rep zetta()   { return Rep( 1e+21L ); }
+inline PHYS_UNITS_CONSTEXPR Rep exa()     { return Rep( 1e+18L ); }
+inline PHYS_UNITS_CONSTEXPR Rep peta()    { return Rep( 1e+15L ); }
+inline PHYS_UNITS_CONSTEXPR Rep tera()    { return Rep( 1e+12L ); }
+inline PHYS_UNITS_CONSTEXPR Rep giga()    { return Rep( 1e+9L ); }
+inline PHYS_UNITS_CONSTEXPR Rep mega()    { return Rep( 1e+6L ); }
+inline PHYS_UNITS_CONSTEXPR Rep kilo()    { return Rep( 1e+3L ); }
+inline PHYS_UNITS_CONSTEXPR Rep hecto()   { return Rep( 1e+2L ); }
+inline PHYS_UNITS_CONSTEXPR Rep deka()    { return Rep( 1e+1L ); }
+inline PHYS_UNITS_CONSTEXPR Rep deci()    { return Rep( 1e-1L ); }
+inline PHYS_UNITS_CONSTEXPR Rep centi()   { return Rep( 1e-2L ); }
+inline PHYS_UNITS_CONSTEXPR Rep milli()   { return Rep( 1e-3L ); }
+inline PHYS_UNITS_CONSTEXPR Rep micro()   { return Rep( 1e-6L ); }
+inline PHYS_UNITS_CONSTEXPR Rep nano()    { return Rep( 1e-9L ); }
+inline PHYS_UNITS_CONSTEXPR Rep pico()    { return Rep( 1e-12L ); }
+inline PHYS_UNITS_CONSTEXPR Rep femto()   { return Rep( 1e-15L ); }
+inline PHYS_UNITS_CONSTEXPR Rep atto()    { return Rep( 1e-18L ); }
+inline PHYS_UNITS_CONSTEXPR Rep zepto()   { return Rep( 1e-21L ); }
+inline PHYS_UNITS_CONSTEXPR Rep yocto()   { return Rep( 1e-24L ); }
 
 // Binary prefixes, pending adoption.
 
-inline Rep kibi() { return Rep( 1024 ); }
-inline Rep mebi() { return Rep( 1024 * kibi() ); }
-inline Rep gibi() { return Rep( 1024 * mebi() ); }
-inline Rep tebi() { return Rep( 1024 * gibi() ); }
-inline Rep pebi() { return Rep( 1024 * tebi() ); }
-inline Rep exbi() { return Rep( 1024 * pebi() ); }
-inline Rep zebi() { return Rep( 1024 * exbi() ); }
-inline Rep yobi() { return Rep( 1024 * zebi() ); }
+inline PHYS_UNITS_CONSTEXPR Rep kibi() { return Rep( 1024 ); }
+inline PHYS_UNITS_CONSTEXPR Rep mebi() { return Rep( 1024 * kibi() ); }
+inline PHYS_UNITS_CONSTEXPR Rep gibi() { return Rep( 1024 * mebi() ); }
+inline PHYS_UNITS_CONSTEXPR Rep tebi() { return Rep( 1024 * gibi() ); }
+inline PHYS_UNITS_CONSTEXPR Rep pebi() { return Rep( 1024 * tebi() ); }
+inline PHYS_UNITS_CONSTEXPR Rep exbi() { return Rep( 1024 * pebi() ); }
+inline PHYS_UNITS_CONSTEXPR Rep zebi() { return Rep( 1024 * exbi() ); }
+inline PHYS_UNITS_CONSTEXPR Rep yobi() { return Rep( 1024 * zebi() ); }
 
 // The rest of the standard dimensional types, as specified in SP811.
 
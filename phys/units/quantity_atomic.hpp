@@ -0,0 +1,181 @@
+/**
+ * \file quantity_atomic.hpp
+ *
+ * \brief   Atomic quantities for lock-free shared totals.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * atomic_quantity<Dims, T> wraps std::atomic<T> and only accepts and yields
+ * quantity<Dims, T>, e.g. an energy total updated from many threads:
+ *
+ *    atomic_quantity< energy_d > total;
+ *
+ *    total.fetch_add( 2.5 * joule() );    // from any thread
+ *    total += 1 * kilo() * joule();
+ *
+ * fetch_add() and fetch_sub() use a compare-exchange loop, as std::atomic<T>
+ * has no arithmetic for floating-point types before C++20. Whether the
+ * operations are lock-free is that of std::atomic<T>; for float and double
+ * on x86-64 they are.
+ *
+ * This header requires C++11 (std::atomic).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_ATOMIC_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_ATOMIC_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_atomic.hpp requires C++11 or later
+#endif
+
+#include <atomic>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * quantity with atomic load, store, exchange and read-modify-write operations.
+ */
+template< typename Dims, typename T = Rep >
+class atomic_quantity
+{
+public:
+   typedef quantity< Dims, T > value_type;
+
+   /**
+    * zero.
+    */
+   atomic_quantity() noexcept
+   : m_value( T( 0 ) )
+   {
+   }
+
+   /**
+    * initial value q; initialization is not atomic.
+    */
+   atomic_quantity( value_type const & q ) noexcept
+   : m_value( detail::value_of( q ) )
+   {
+   }
+
+   atomic_quantity( atomic_quantity const & ) = delete;
+   atomic_quantity & operator=( atomic_quantity const & ) = delete;
+
+   /**
+    * true if the operations on this object are lock-free.
+    */
+   bool is_lock_free() const noexcept
+   {
+      return m_value.is_lock_free();
+   }
+
+   value_type load( std::memory_order const order = std::memory_order_seq_cst ) const noexcept
+   {
+      return wrap( m_value.load( order ) );
+   }
+
+   void store( value_type const & q, std::memory_order const order = std::memory_order_seq_cst ) noexcept
+   {
+      m_value.store( detail::value_of( q ), order );
+   }
+
+   /**
+    * replace the value by q, return the previous value.
+    */
+   value_type exchange( value_type const & q, std::memory_order const order = std::memory_order_seq_cst ) noexcept
+   {
+      return wrap( m_value.exchange( detail::value_of( q ), order ) );
+   }
+
+   /**
+    * if the value equals expected, replace it by desired and return true;
+    * otherwise load the value into expected and return false.
+    */
+   bool compare_exchange_strong( value_type & expected, value_type const & desired,
+      std::memory_order const order = std::memory_order_seq_cst ) noexcept
+   {
+      return m_value.compare_exchange_strong(
+         expected.get( detail::permit<T>() ), detail::value_of( desired ), order );
+   }
+
+   /**
+    * as compare_exchange_strong(), but may fail spuriously; for use in a loop.
+    */
+   bool compare_exchange_weak( value_type & expected, value_type const & desired,
+      std::memory_order const order = std::memory_order_seq_cst ) noexcept
+   {
+      return m_value.compare_exchange_weak(
+         expected.get( detail::permit<T>() ), detail::value_of( desired ), order );
+   }
+
+   /**
+    * add q, return the previous value.
+    */
+   value_type fetch_add( value_type const & q, std::memory_order const order = std::memory_order_seq_cst ) noexcept
+   {
+      T const delta = detail::value_of( q );
+      T old = m_value.load( std::memory_order_relaxed );
+
+      while ( ! m_value.compare_exchange_weak( old, old + delta, order, std::memory_order_relaxed ) )
+      {
+      }
+      return wrap( old );
+   }
+
+   /**
+    * subtract q, return the previous value.
+    */
+   value_type fetch_sub( value_type const & q, std::memory_order const order = std::memory_order_seq_cst ) noexcept
+   {
+      return fetch_add( -q, order );
+   }
+
+   /**
+    * add q, return the new value.
+    */
+   value_type operator+=( value_type const & q ) noexcept
+   {
+      return fetch_add( q ) + q;
+   }
+
+   /**
+    * subtract q, return the new value.
+    */
+   value_type operator-=( value_type const & q ) noexcept
+   {
+      return fetch_sub( q ) - q;
+   }
+
+   atomic_quantity & operator=( value_type const & q ) noexcept
+   {
+      store( q );
+      return *this;
+   }
+
+   operator value_type() const noexcept
+   {
+      return load();
+   }
+
+private:
+   static value_type wrap( T const & v )
+   {
+      return value_type( detail::permit<T>( v ) );
+   }
+
+   std::atomic<T> m_value;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_ATOMIC_HPP_INCLUDED
+
+/*
+ * end of file
+ */
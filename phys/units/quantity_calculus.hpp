@@ -0,0 +1,342 @@
+/**
+ * \file quantity_calculus.hpp
+ *
+ * \brief   Numerical integration and differentiation of sampled quantities.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * The functions take series as pointer and length, y[0..n) sampled at
+ * x[0..n) or at uniform spacing dx. Results obtain their dimensions via
+ * detail::product<> (integrals) and detail::quotient<> (derivatives), e.g.
+ * integrating power over time yields energy, differentiating position
+ * with respect to time yields speed.
+ *
+ * - trapezoid()            - integral, trapezoidal rule
+ * - simpson()              - integral, composite Simpson rule, uniform spacing
+ * - cumulative_trapezoid() - running integral, out[0] = 0
+ * - derivative()           - second-order finite differences
+ *
+ * Inner loops run on the representation values with independent partial
+ * sums, so that compilers can vectorize them. cumulative_trapezoid() is a
+ * blocked two-pass prefix scan; its blocks run in parallel when compiled
+ * with OpenMP enabled.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_CALCULUS_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_CALCULUS_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#include <cstddef>  // for size_t
+#include <vector>
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * sum of ( y[i] + y[i+1] ) * ( x[i+1] - x[i] ), i in [lo, hi); four partial sums.
+ */
+template< typename YDims, typename XDims, typename T >
+inline T trapezoid_sum( quantity< YDims, T > const * y, quantity< XDims, T > const * x, std::size_t lo, std::size_t const hi )
+{
+   T s0( 0 ), s1( 0 ), s2( 0 ), s3( 0 );
+
+   std::size_t const quad = lo + ( hi - lo ) / 4 * 4;
+
+   for ( ; lo < quad; lo += 4 )
+   {
+      s0 += ( value_of( y[lo    ] ) + value_of( y[lo + 1] ) ) * ( value_of( x[lo + 1] ) - value_of( x[lo    ] ) );
+      s1 += ( value_of( y[lo + 1] ) + value_of( y[lo + 2] ) ) * ( value_of( x[lo + 2] ) - value_of( x[lo + 1] ) );
+      s2 += ( value_of( y[lo + 2] ) + value_of( y[lo + 3] ) ) * ( value_of( x[lo + 3] ) - value_of( x[lo + 2] ) );
+      s3 += ( value_of( y[lo + 3] ) + value_of( y[lo + 4] ) ) * ( value_of( x[lo + 4] ) - value_of( x[lo + 3] ) );
+   }
+
+   for ( ; lo < hi; ++lo )
+   {
+      s0 += ( value_of( y[lo] ) + value_of( y[lo + 1] ) ) * ( value_of( x[lo + 1] ) - value_of( x[lo] ) );
+   }
+
+   return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+/**
+ * sum of y[i], i in [lo, hi) with stride, four partial sums.
+ */
+template< typename YDims, typename T >
+inline T strided_sum( quantity< YDims, T > const * y, std::size_t lo, std::size_t const hi, std::size_t const stride )
+{
+   T s0( 0 ), s1( 0 ), s2( 0 ), s3( 0 );
+
+   std::size_t const quad = lo + ( hi - lo ) / ( 4 * stride ) * ( 4 * stride );
+
+   for ( ; lo < quad; lo += 4 * stride )
+   {
+      s0 += value_of( y[lo             ] );
+      s1 += value_of( y[lo +     stride] );
+      s2 += value_of( y[lo + 2 * stride] );
+      s3 += value_of( y[lo + 3 * stride] );
+   }
+
+   for ( ; lo < hi; lo += stride )
+   {
+      s0 += value_of( y[lo] );
+   }
+
+   return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+} // namespace detail
+
+/**
+ * integral of y over x by the trapezoidal rule; zero for fewer than two samples.
+ */
+template< typename YDims, typename XDims, typename T >
+inline typename detail::product< YDims, XDims, T >::type
+trapezoid( quantity< YDims, T > const * y, quantity< XDims, T > const * x, std::size_t const n )
+{
+   typedef TYPENAME_TYPE_K detail::product< YDims, XDims, T >::dimension_type result_dims;
+
+   T const sum = n < 2 ? T( 0 ) : detail::trapezoid_sum( y, x, 0, n - 1 );
+
+   return detail::from_value< result_dims, T >( T( 0.5 ) * sum );
+}
+
+/**
+ * integral of y sampled at uniform spacing dx, by the trapezoidal rule.
+ */
+template< typename YDims, typename XDims, typename T >
+inline typename detail::product< YDims, XDims, T >::type
+trapezoid( quantity< YDims, T > const * y, std::size_t const n, quantity< XDims, T > const & dx )
+{
+   typedef TYPENAME_TYPE_K detail::product< YDims, XDims, T >::dimension_type result_dims;
+
+   if ( n < 2 )
+   {
+      return detail::from_value< result_dims, T >( T( 0 ) );
+   }
+
+   T const inner = detail::strided_sum( y, 1, n - 1, 1 );
+   T const ends  = detail::value_of( y[0] ) + detail::value_of( y[n - 1] );
+
+   return detail::from_value< result_dims, T >( detail::value_of( dx ) * ( inner + T( 0.5 ) * ends ) );
+}
+
+/**
+ * integral of y sampled at uniform spacing dx, by the composite Simpson rule;
+ * for an even number of samples, the last three intervals use Simpson's 3/8 rule.
+ * Throws quantity_error for fewer than three samples.
+ */
+template< typename YDims, typename XDims, typename T >
+inline typename detail::product< YDims, XDims, T >::type
+simpson( quantity< YDims, T > const * y, std::size_t const n, quantity< XDims, T > const & dx )
+{
+   typedef TYPENAME_TYPE_K detail::product< YDims, XDims, T >::dimension_type result_dims;
+
+   if ( n < 3 )
+   {
+      throw quantity_error( "quantity: simpson: need at least three samples" );
+   }
+
+   // odd number of samples m handled by the 1/3 rule:
+
+   std::size_t const m = n % 2 ? n : n - 3;
+
+   T sum( 0 );
+
+   if ( m >= 3 )
+   {
+      T const odd  = detail::strided_sum( y, 1, m - 1, 2 );
+      T const even = detail::strided_sum( y, 2, m - 1, 2 );
+
+      sum = ( detail::value_of( y[0] ) + T( 4 ) * odd + T( 2 ) * even + detail::value_of( y[m - 1] ) ) / T( 3 );
+   }
+
+   if ( m != n )
+   {
+      sum += T( 3 ) / T( 8 ) * (
+               detail::value_of( y[n - 4] ) + T( 3 ) * detail::value_of( y[n - 3] )
+             + T( 3 ) * detail::value_of( y[n - 2] ) + detail::value_of( y[n - 1] ) );
+   }
+
+   return detail::from_value< result_dims, T >( detail::value_of( dx ) * sum );
+}
+
+/**
+ * running integral of y over x by the trapezoidal rule: out[0] = 0,
+ * out[i] = integral from x[0] to x[i]. out must have room for n results.
+ */
+template< typename YDims, typename XDims, typename T >
+inline void
+cumulative_trapezoid( quantity< YDims, T > const * y, quantity< XDims, T > const * x, std::size_t const n,
+   typename detail::product< YDims, XDims, T >::type * out )
+{
+   typedef TYPENAME_TYPE_K detail::product< YDims, XDims, T >::dimension_type result_dims;
+
+   if ( n == 0 )
+   {
+      return;
+   }
+
+   // without OpenMP, a single block: one pass over the data
+
+   long const count   = long( n ) - 1;
+#ifdef _OPENMP
+   long const block   = 16384;
+#else
+   long const block   = count > 0 ? count : 1;
+#endif
+   long const nblocks = ( count + block - 1 ) / block;
+
+   std::vector< T > offset( nblocks + 1, T( 0 ) );
+
+   // pass 1: block totals, vectorizable reduction
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+   for ( long b = 0; b < nblocks - 1; ++b )
+   {
+      offset[b + 1] = T( 0.5 ) * detail::trapezoid_sum( y, x, b * block, b * block + block );
+   }
+
+   // pass 2: block offsets
+
+   for ( long b = 1; b <= nblocks; ++b )
+   {
+      offset[b] += offset[b - 1];
+   }
+
+   // pass 3: prefix sums within each block, starting at the block offset
+
+   out[0] = detail::from_value< result_dims, T >( T( 0 ) );
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+   for ( long b = 0; b < nblocks; ++b )
+   {
+      long const lo  = b * block;
+      long const hi  = lo + block < count ? lo + block : count;
+
+      T sum( offset[b] );
+
+      for ( long i = lo; i < hi; ++i )
+      {
+         sum += T( 0.5 ) * ( detail::value_of( y[i] ) + detail::value_of( y[i + 1] ) )
+                         * ( detail::value_of( x[i + 1] ) - detail::value_of( x[i] ) );
+
+         out[i + 1] = detail::from_value< result_dims, T >( sum );
+      }
+   }
+}
+
+/**
+ * derivative of y with respect to x by second-order finite differences
+ * (central in the interior, one-sided at the ends; first order for n == 2).
+ * out must have room for n results. Throws quantity_error for fewer than two samples.
+ */
+template< typename YDims, typename XDims, typename T >
+inline void
+derivative( quantity< YDims, T > const * y, quantity< XDims, T > const * x, std::size_t const n,
+   typename detail::quotient< YDims, XDims, T >::type * out )
+{
+   typedef TYPENAME_TYPE_K detail::quotient< YDims, XDims, T >::dimension_type result_dims;
+
+   if ( n < 2 )
+   {
+      throw quantity_error( "quantity: derivative: need at least two samples" );
+   }
+
+   if ( n == 2 )
+   {
+      T const d = ( detail::value_of( y[1] ) - detail::value_of( y[0] ) )
+                / ( detail::value_of( x[1] ) - detail::value_of( x[0] ) );
+
+      out[0] = out[1] = detail::from_value< result_dims, T >( d );
+      return;
+   }
+
+   for ( std::size_t i = 1; i < n - 1; ++i )
+   {
+      T const h1 = detail::value_of( x[i] ) - detail::value_of( x[i - 1] );
+      T const h2 = detail::value_of( x[i + 1] ) - detail::value_of( x[i] );
+
+      out[i] = detail::from_value< result_dims, T >(
+           - h2 / ( h1 * ( h1 + h2 ) ) * detail::value_of( y[i - 1] )
+           + ( h2 - h1 ) / ( h1 * h2 ) * detail::value_of( y[i] )
+           + h1 / ( h2 * ( h1 + h2 ) ) * detail::value_of( y[i + 1] ) );
+   }
+
+   {
+      T const h1 = detail::value_of( x[1] ) - detail::value_of( x[0] );
+      T const h2 = detail::value_of( x[2] ) - detail::value_of( x[1] );
+
+      out[0] = detail::from_value< result_dims, T >(
+           - ( 2 * h1 + h2 ) / ( h1 * ( h1 + h2 ) ) * detail::value_of( y[0] )
+           + ( h1 + h2 ) / ( h1 * h2 ) * detail::value_of( y[1] )
+           - h1 / ( h2 * ( h1 + h2 ) ) * detail::value_of( y[2] ) );
+   }
+
+   {
+      T const h1 = detail::value_of( x[n - 2] ) - detail::value_of( x[n - 3] );
+      T const h2 = detail::value_of( x[n - 1] ) - detail::value_of( x[n - 2] );
+
+      out[n - 1] = detail::from_value< result_dims, T >(
+             h2 / ( h1 * ( h1 + h2 ) ) * detail::value_of( y[n - 3] )
+           - ( h1 + h2 ) / ( h1 * h2 ) * detail::value_of( y[n - 2] )
+           + ( 2 * h2 + h1 ) / ( h2 * ( h1 + h2 ) ) * detail::value_of( y[n - 1] ) );
+   }
+}
+
+/**
+ * derivative of y sampled at uniform spacing dx, by second-order finite differences.
+ * out must have room for n results. Throws quantity_error for fewer than two samples.
+ */
+template< typename YDims, typename XDims, typename T >
+inline void
+derivative( quantity< YDims, T > const * y, std::size_t const n, quantity< XDims, T > const & dx,
+   typename detail::quotient< YDims, XDims, T >::type * out )
+{
+   typedef TYPENAME_TYPE_K detail::quotient< YDims, XDims, T >::dimension_type result_dims;
+
+   if ( n < 2 )
+   {
+      throw quantity_error( "quantity: derivative: need at least two samples" );
+   }
+
+   T const f = T( 1 ) / detail::value_of( dx );
+
+   if ( n == 2 )
+   {
+      out[0] = out[1] = detail::from_value< result_dims, T >( f * ( detail::value_of( y[1] ) - detail::value_of( y[0] ) ) );
+      return;
+   }
+
+   T const h = T( 0.5 ) * f;
+
+   for ( std::size_t i = 1; i < n - 1; ++i )
+   {
+      out[i] = detail::from_value< result_dims, T >( h * ( detail::value_of( y[i + 1] ) - detail::value_of( y[i - 1] ) ) );
+   }
+
+   out[0] = detail::from_value< result_dims, T >( h * (
+      - 3 * detail::value_of( y[0] ) + 4 * detail::value_of( y[1] ) - detail::value_of( y[2] ) ) );
+
+   out[n - 1] = detail::from_value< result_dims, T >( h * (
+        3 * detail::value_of( y[n - 1] ) - 4 * detail::value_of( y[n - 2] ) + detail::value_of( y[n - 3] ) ) );
+}
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_CALCULUS_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,110 @@
+/**
+ * \file quantity_chrono.hpp
+ *
+ * \brief   Conversions between time quantities and std::chrono::duration.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * to_quantity() turns a std::chrono::duration into a quantity< time_interval_d >
+ * and as_duration() turns a time quantity into a duration of seconds, which
+ * converts implicitly to any duration where std::chrono allows it:
+ *
+ *    auto t0 = std::chrono::steady_clock::now();
+ *    ...
+ *    quantity< time_interval_d > dt = to_quantity( std::chrono::steady_clock::now() - t0 );
+ *
+ *    std::chrono::duration< double, std::milli > ms = as_duration( 2.5 * second() );
+ *    std::chrono::milliseconds step = to_duration< std::chrono::milliseconds >( dt );
+ *
+ * The factor of the duration's period is folded at compile time: a
+ * conversion costs one multiplication, or none for seconds. Durations with
+ * an integer tick type and a period of whole seconds give a quantity with
+ * that integer type, which is exact; others give a quantity of Rep, or of
+ * the duration's own floating-point tick type. to_duration() rounds like
+ * std::chrono::duration_cast, towards zero for integer ticks.
+ *
+ * This header requires C++11 (std::chrono).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_CHRONO_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_CHRONO_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_chrono.hpp requires C++11 or later
+#endif
+
+#include <chrono>
+#include <ratio>
+#include <type_traits>
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * value type and factor to seconds for a duration with tick type R and period P.
+ */
+template< typename R, typename P >
+struct chrono_traits
+{
+   enum { exact = std::is_integral<R>::value && P::den == 1 };
+
+   typedef typename std::conditional< exact, R,
+      typename std::conditional< std::is_floating_point<R>::value, R, Rep >::type >::type value_type;
+
+   static constexpr value_type factor()
+   {
+      return exact ? value_type( P::num ) : value_type( P::num ) / value_type( P::den );
+   }
+};
+
+} // namespace detail
+
+/**
+ * time quantity for duration d.
+ */
+template< typename R, typename P >
+inline quantity< time_interval_d, typename detail::chrono_traits<R, P>::value_type >
+to_quantity( std::chrono::duration<R, P> const & d )
+{
+   typedef detail::chrono_traits<R, P> traits;
+   typedef typename traits::value_type value_type;
+
+   return quantity< time_interval_d, value_type >( detail::permit< value_type >(
+      P::num == 1 && P::den == 1 ? value_type( d.count() ) : value_type( d.count() ) * traits::factor() ) );
+}
+
+/**
+ * duration of seconds for time quantity q, with the representation type of q.
+ */
+template< typename T >
+inline std::chrono::duration<T>
+as_duration( quantity< time_interval_d, T > const & q )
+{
+   return std::chrono::duration<T>( detail::value_of( q ) );
+}
+
+/**
+ * duration of type Duration for time quantity q, as by std::chrono::duration_cast.
+ */
+template< typename Duration, typename T >
+inline Duration
+to_duration( quantity< time_interval_d, T > const & q )
+{
+   return std::chrono::duration_cast< Duration >( as_duration( q ) );
+}
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_CHRONO_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,677 @@
+/**
+ * \file quantity_column_file.hpp
+ *
+ * \brief   Self-describing binary column files of quantities, loaded by memory mapping.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * column_file_writer writes arrays of quantities as named columns; the file
+ * records the dimensions, representation type and scale of each column:
+ *
+ *    column_file_writer w;
+ *    w.add( "voltage", &u[0], u.size() );
+ *    w.add( "current", &i[0], i.size(), 1e-3 );   // stored in mA
+ *    w.write( "run-17.col" );
+ *
+ * column_file maps a file into memory and hands out typed views of its
+ * columns without copying, after checking the dimensions and type:
+ *
+ *    column_file f( "run-17.col" );
+ *
+ *    column_view< electric_potential_d > u = f.column< electric_potential_d >( "voltage" );
+ *    quantity< electric_potential_d > peak = *std::max_element( u.begin(), u.end() );
+ *
+ *    std::vector< quantity< electric_current_d > > i = f.copy_column< electric_current_d >( "current" );
+ *
+ * column() throws quantity_error if the dimensions or the representation
+ * type differ from the requested ones, or if the column has a scale other
+ * than 1; copy_column() converts any stored type and applies the scale.
+ * Scaled values of integral type are rounded to nearest and saturated, both
+ * when written and when copied.
+ *
+ * Layout, in native byte order with a byte-order mark: a 64-byte file
+ * header with magic "PHYSCOL", byte-order mark, version and column count;
+ * a 128-byte descriptor per column with its seven dimension exponents,
+ * value kind ('f', 'i' or 'u') and size, scale, offset, row count and
+ * name; the values of each column, starting on a 64-byte boundary.
+ *
+ * This header requires C++11 and POSIX mmap() or Windows file mapping.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_COLUMN_FILE_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_COLUMN_FILE_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_column_file.hpp requires C++11 or later
+#endif
+
+#include <cmath>    // for round()
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <cstring>  // for memcpy, memcmp
+#include <fstream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * description of a column in a column file.
+ */
+struct column_info
+{
+   std::string name;
+   int dim[7];
+   char kind;          // 'f' floating-point, 'i' signed, 'u' unsigned integer
+   unsigned size;      // bytes per value
+   double scale;       // SI value is stored value times scale
+   std::uint64_t offset;
+   std::uint64_t rows;
+};
+
+namespace detail {
+
+enum { column_alignment = 64 };
+
+/**
+ * file header, 64 bytes.
+ */
+struct column_file_header
+{
+   char magic[8];
+   std::uint32_t byte_order;
+   std::uint32_t version;
+   std::uint64_t columns;
+   std::uint64_t reserved[5];
+};
+
+/**
+ * column descriptor, 128 bytes.
+ */
+struct column_header
+{
+   signed char dim[8];
+   char kind;
+   unsigned char size;
+   unsigned char reserved[6];
+   double scale;
+   std::uint64_t offset;
+   std::uint64_t rows;
+   char name[88];
+};
+
+static_assert( sizeof( column_file_header ) == 64, "column file header must be 64 bytes" );
+static_assert( sizeof( column_header ) == 128, "column header must be 128 bytes" );
+
+char const column_magic[8] = "PHYSCOL";
+
+std::uint32_t const column_byte_order = 0x01020304u;
+
+/**
+ * kind of value type T.
+ */
+template< typename T >
+struct column_kind
+{
+   static_assert( std::is_arithmetic<T>::value, "column values must be of arithmetic type" );
+
+   enum { value = std::is_floating_point<T>::value ? 'f' : std::is_signed<T>::value ? 'i' : 'u' };
+};
+
+/**
+ * v as floating-point T.
+ */
+template< typename T >
+inline T column_cast( double const v, std::false_type )
+{
+   return static_cast<T>( v );
+}
+
+/**
+ * v as integral T, rounded to nearest and saturated; NaN gives 0.
+ */
+template< typename T >
+inline T column_cast( double const v, std::true_type )
+{
+   double const r = std::round( v );
+
+   return r != r ? T( 0 ) :
+      r <= double( ( std::numeric_limits<T>::min )() ) ? ( std::numeric_limits<T>::min )() :
+      r >= double( ( std::numeric_limits<T>::max )() ) ? ( std::numeric_limits<T>::max )() : static_cast<T>( r );
+}
+
+/**
+ * v as T, rounded to nearest and saturated for integral T.
+ */
+template< typename T >
+inline T column_cast( double const v )
+{
+   return column_cast<T>( v, std::is_integral<T>() );
+}
+
+/**
+ * stored value at p of the given kind and size, as T.
+ */
+template< typename T >
+T column_value( char const * const p, char const kind, unsigned const size )
+{
+#define PHYS_UNITS_COLUMN_VALUE( k, type ) \
+   if ( kind == k && size == sizeof( type ) ) { type v; std::memcpy( &v, p, sizeof v ); return static_cast<T>( v ); }
+
+   PHYS_UNITS_COLUMN_VALUE( 'f', float )
+   PHYS_UNITS_COLUMN_VALUE( 'f', double )
+   PHYS_UNITS_COLUMN_VALUE( 'i', std::int8_t )
+   PHYS_UNITS_COLUMN_VALUE( 'i', std::int16_t )
+   PHYS_UNITS_COLUMN_VALUE( 'i', std::int32_t )
+   PHYS_UNITS_COLUMN_VALUE( 'i', std::int64_t )
+   PHYS_UNITS_COLUMN_VALUE( 'u', std::uint8_t )
+   PHYS_UNITS_COLUMN_VALUE( 'u', std::uint16_t )
+   PHYS_UNITS_COLUMN_VALUE( 'u', std::uint32_t )
+   PHYS_UNITS_COLUMN_VALUE( 'u', std::uint64_t )
+
+#undef PHYS_UNITS_COLUMN_VALUE
+
+   throw quantity_error( "quantity: column file: unsupported value type" );
+}
+
+/**
+ * read-only memory mapping of a whole file.
+ */
+class mapped_file
+{
+public:
+   explicit mapped_file( std::string const & path )
+   : m_data( 0 )
+   , m_size( 0 )
+   {
+#ifdef _WIN32
+      HANDLE const file = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0 );
+      if ( file == INVALID_HANDLE_VALUE )
+      {
+         throw quantity_error( "quantity: column file: cannot open '" + path + "'" );
+      }
+      LARGE_INTEGER size;
+      HANDLE const mapping = GetFileSizeEx( file, &size ) && size.QuadPart > 0
+         ? CreateFileMappingA( file, 0, PAGE_READONLY, 0, 0, 0 ) : 0;
+      CloseHandle( file );
+      if ( ! mapping )
+      {
+         throw quantity_error( "quantity: column file: cannot map '" + path + "'" );
+      }
+      m_data = static_cast< char const * >( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+      CloseHandle( mapping );
+      m_size = static_cast< std::size_t >( size.QuadPart );
+#else
+      int const fd = ::open( path.c_str(), O_RDONLY );
+      if ( fd < 0 )
+      {
+         throw quantity_error( "quantity: column file: cannot open '" + path + "'" );
+      }
+      struct stat st;
+      if ( ::fstat( fd, &st ) == 0 && st.st_size > 0 )
+      {
+         void * const p = ::mmap( 0, static_cast< std::size_t >( st.st_size ), PROT_READ, MAP_SHARED, fd, 0 );
+         if ( p != MAP_FAILED )
+         {
+            m_data = static_cast< char const * >( p );
+            m_size = static_cast< std::size_t >( st.st_size );
+         }
+      }
+      ::close( fd );
+#endif
+      if ( ! m_data )
+      {
+         throw quantity_error( "quantity: column file: cannot map '" + path + "'" );
+      }
+   }
+
+   ~mapped_file()
+   {
+#ifdef _WIN32
+      UnmapViewOfFile( m_data );
+#else
+      ::munmap( const_cast< char * >( m_data ), m_size );
+#endif
+   }
+
+   mapped_file( mapped_file const & ) = delete;
+   mapped_file & operator=( mapped_file const & ) = delete;
+
+   char const * data() const
+   {
+      return m_data;
+   }
+
+   std::size_t size() const
+   {
+      return m_size;
+   }
+
+private:
+   char const * m_data;
+   std::size_t m_size;
+};
+
+} // namespace detail
+
+/**
+ * read-only view of a column of quantities, valid while its column_file lives.
+ */
+template< typename Dims, typename T = Rep >
+class column_view
+{
+public:
+   typedef quantity< Dims, T > value_type;
+   typedef value_type const * const_iterator;
+
+   static_assert( sizeof( value_type ) == sizeof( T ), "quantity must have the layout of its representation type" );
+
+   column_view( value_type const * const data, std::size_t const size )
+   : m_data( data )
+   , m_size( size )
+   {
+   }
+
+   std::size_t size() const
+   {
+      return m_size;
+   }
+
+   bool empty() const
+   {
+      return m_size == 0;
+   }
+
+   value_type const * data() const
+   {
+      return m_data;
+   }
+
+   value_type const & operator[]( std::size_t const i ) const
+   {
+      return m_data[i];
+   }
+
+   const_iterator begin() const
+   {
+      return m_data;
+   }
+
+   const_iterator end() const
+   {
+      return m_data + m_size;
+   }
+
+private:
+   value_type const * m_data;
+   std::size_t m_size;
+};
+
+/**
+ * writer of a column file.
+ */
+class column_file_writer
+{
+public:
+   /**
+    * add column name with the n quantities at data, stored as value / scale,
+    * rounded to nearest and saturated for integral T; data must remain valid
+    * until write().
+    */
+   template< typename Dims, typename T >
+   void add( std::string const & name, quantity< Dims, T > const * const data, std::size_t const n, double const scale = 1 )
+   {
+      if ( name.size() >= sizeof( detail::column_header().name ) )
+      {
+         throw quantity_error( "quantity: column file: column name '" + name + "' too long" );
+      }
+      if ( ! ( scale != 0 ) )
+      {
+         throw quantity_error( "quantity: column file: scale of column '" + name + "' must be non-zero" );
+      }
+
+      column c;
+      c.header = detail::column_header();
+      c.header.dim[0] = Dims::dim1;
+      c.header.dim[1] = Dims::dim2;
+      c.header.dim[2] = Dims::dim3;
+      c.header.dim[3] = Dims::dim4;
+      c.header.dim[4] = Dims::dim5;
+      c.header.dim[5] = Dims::dim6;
+      c.header.dim[6] = Dims::dim7;
+      c.header.kind = detail::column_kind<T>::value;
+      c.header.size = sizeof( T );
+      c.header.scale = scale;
+      c.header.rows = n;
+      name.copy( c.header.name, name.size() );
+      c.data = reinterpret_cast< char const * >( data );
+      c.rescale = scale == 1 ? 0 : &rescale<T>;
+
+      m_columns.push_back( c );
+   }
+
+   /**
+    * write the file at path; throws quantity_error on failure.
+    */
+   void write( std::string const & path )
+   {
+      std::uint64_t offset = align( sizeof( detail::column_file_header ) + m_columns.size() * sizeof( detail::column_header ) );
+
+      for ( std::size_t i = 0; i < m_columns.size(); ++i )
+      {
+         m_columns[i].header.offset = offset;
+         offset = align( offset + m_columns[i].header.rows * m_columns[i].header.size );
+      }
+
+      std::ofstream os( path.c_str(), std::ios::binary | std::ios::trunc );
+
+      detail::column_file_header h = detail::column_file_header();
+      std::memcpy( h.magic, detail::column_magic, sizeof h.magic );
+      h.byte_order = detail::column_byte_order;
+      h.version = 1;
+      h.columns = m_columns.size();
+
+      os.write( reinterpret_cast< char const * >( &h ), sizeof h );
+      for ( std::size_t i = 0; i < m_columns.size(); ++i )
+      {
+         os.write( reinterpret_cast< char const * >( &m_columns[i].header ), sizeof m_columns[i].header );
+      }
+
+      std::uint64_t position = sizeof h + m_columns.size() * sizeof( detail::column_header );
+      std::vector< char > buffer;
+
+      for ( std::size_t i = 0; i < m_columns.size(); ++i )
+      {
+         column const & c = m_columns[i];
+
+         pad( os, c.header.offset - position );
+
+         std::size_t const bytes = static_cast< std::size_t >( c.header.rows * c.header.size );
+         if ( c.rescale )
+         {
+            buffer.resize( bytes );
+            c.rescale( c.data, &buffer[0], static_cast< std::size_t >( c.header.rows ), c.header.scale );
+            os.write( &buffer[0], bytes );
+         }
+         else
+         {
+            os.write( c.data, bytes );
+         }
+         position = c.header.offset + bytes;
+      }
+      pad( os, align( position ) - position );
+
+      if ( ! os.flush() )
+      {
+         throw quantity_error( "quantity: column file: cannot write '" + path + "'" );
+      }
+   }
+
+private:
+   struct column
+   {
+      detail::column_header header;
+      char const * data;
+      void (*rescale)( char const *, char *, std::size_t, double );
+   };
+
+   template< typename T >
+   static void rescale( char const * const from, char * const to, std::size_t const n, double const scale )
+   {
+      T const * const in = reinterpret_cast< T const * >( from );
+      T * const out = reinterpret_cast< T * >( to );
+
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         out[i] = detail::column_cast<T>( in[i] / scale );
+      }
+   }
+
+   static std::uint64_t align( std::uint64_t const n )
+   {
+      return ( n + detail::column_alignment - 1 ) / detail::column_alignment * detail::column_alignment;
+   }
+
+   static void pad( std::ostream & os, std::uint64_t n )
+   {
+      char const zeros[ detail::column_alignment ] = {};
+
+      for ( ; n > 0; n -= n < sizeof zeros ? n : sizeof zeros )
+      {
+         os.write( zeros, static_cast< std::streamsize >( n < sizeof zeros ? n : sizeof zeros ) );
+      }
+   }
+
+   std::vector< column > m_columns;
+};
+
+/**
+ * memory-mapped column file.
+ */
+class column_file
+{
+public:
+   /**
+    * map the file at path and read its column descriptors; throws quantity_error if not a valid column file.
+    */
+   explicit column_file( std::string const & path )
+   : m_file( path )
+   , m_columns()
+   {
+      char const * const p = m_file.data();
+      std::size_t const size = m_file.size();
+
+      detail::column_file_header h;
+      if ( size < sizeof h )
+      {
+         throw quantity_error( "quantity: column file: '" + path + "' is too short" );
+      }
+      std::memcpy( &h, p, sizeof h );
+
+      if ( std::memcmp( h.magic, detail::column_magic, sizeof h.magic ) != 0 )
+      {
+         throw quantity_error( "quantity: column file: '" + path + "' is not a column file" );
+      }
+      if ( h.byte_order != detail::column_byte_order )
+      {
+         throw quantity_error( "quantity: column file: '" + path + "' has a different byte order" );
+      }
+      if ( h.version != 1 )
+      {
+         throw quantity_error( "quantity: column file: '" + path + "' has an unsupported version" );
+      }
+      if ( h.columns > ( size - sizeof h ) / sizeof( detail::column_header ) )
+      {
+         throw quantity_error( "quantity: column file: '" + path + "' is truncated" );
+      }
+
+      for ( std::uint64_t i = 0; i < h.columns; ++i )
+      {
+         detail::column_header c;
+         std::memcpy( &c, p + sizeof h + i * sizeof c, sizeof c );
+
+         column_info info;
+         info.name.assign( c.name, name_length( c.name, sizeof c.name ) );
+         for ( int d = 0; d < 7; ++d )
+         {
+            info.dim[d] = c.dim[d];
+         }
+         info.kind = c.kind;
+         info.size = c.size;
+         info.scale = c.scale;
+         info.offset = c.offset;
+         info.rows = c.rows;
+
+         if ( c.size == 0 || c.offset % detail::column_alignment != 0 || c.offset > size || c.rows > ( size - c.offset ) / c.size )
+         {
+            throw quantity_error( "quantity: column file: column '" + info.name + "' lies outside '" + path + "'" );
+         }
+         m_columns.push_back( info );
+      }
+   }
+
+   /**
+    * number of columns.
+    */
+   std::size_t size() const
+   {
+      return m_columns.size();
+   }
+
+   /**
+    * description of column i.
+    */
+   column_info const & info( std::size_t const i ) const
+   {
+      return m_columns.at( i );
+   }
+
+   /**
+    * index of the column with the given name; throws quantity_error if there is none.
+    */
+   std::size_t find( std::string const & name ) const
+   {
+      for ( std::size_t i = 0; i < m_columns.size(); ++i )
+      {
+         if ( m_columns[i].name == name )
+         {
+            return i;
+         }
+      }
+      throw quantity_error( "quantity: column file: no column '" + name + "'" );
+   }
+
+   /**
+    * zero-copy view of column i; throws quantity_error unless it holds unscaled values of type T with dimensions Dims.
+    */
+   template< typename Dims, typename T = Rep >
+   column_view< Dims, T > column( std::size_t const i ) const
+   {
+      column_info const & c = check< Dims >( i );
+
+      if ( c.kind != detail::column_kind<T>::value || c.size != sizeof( T ) )
+      {
+         throw quantity_error( "quantity: column file: column '" + c.name + "' has a different value type" );
+      }
+      if ( c.scale != 1 )
+      {
+         throw quantity_error( "quantity: column file: column '" + c.name + "' is scaled; use copy_column()" );
+      }
+      return column_view< Dims, T >(
+         reinterpret_cast< quantity< Dims, T > const * >( m_file.data() + c.offset ), static_cast< std::size_t >( c.rows ) );
+   }
+
+   template< typename Dims, typename T = Rep >
+   column_view< Dims, T > column( std::string const & name ) const
+   {
+      return column< Dims, T >( find( name ) );
+   }
+
+   /**
+    * copy of column i converted to T and scaled, rounded to nearest and
+    * saturated for integral T; throws quantity_error unless it has dimensions Dims.
+    */
+   template< typename Dims, typename T = Rep >
+   std::vector< quantity< Dims, T > > copy_column( std::size_t const i ) const
+   {
+      column_info const & c = check< Dims >( i );
+
+      std::size_t const n = static_cast< std::size_t >( c.rows );
+      std::vector< quantity< Dims, T > > result( n );
+
+      char const * const p = m_file.data() + c.offset;
+
+      if ( c.kind == detail::column_kind<T>::value && c.size == sizeof( T ) && ( c.scale == 1 || std::is_floating_point<T>::value ) )
+      {
+         // same type, unscaled or floating-point: one block copy, then the scale
+
+         if ( n > 0 )
+         {
+            std::memcpy( &result[0], p, n * sizeof( T ) );
+         }
+         if ( c.scale != 1 )
+         {
+            for ( std::size_t k = 0; k < n; ++k )
+            {
+               result[k] *= c.scale;
+            }
+         }
+      }
+      else
+      {
+         for ( std::size_t k = 0; k < n; ++k )
+         {
+            result[k] = quantity< Dims, T >( detail::permit<T>(
+               detail::column_cast<T>( detail::column_value<double>( p + k * c.size, c.kind, c.size ) * c.scale ) ) );
+         }
+      }
+      return result;
+   }
+
+   template< typename Dims, typename T = Rep >
+   std::vector< quantity< Dims, T > > copy_column( std::string const & name ) const
+   {
+      return copy_column< Dims, T >( find( name ) );
+   }
+
+private:
+   template< typename Dims >
+   column_info const & check( std::size_t const i ) const
+   {
+      column_info const & c = info( i );
+
+      int const dim[7] = { Dims::dim1, Dims::dim2, Dims::dim3, Dims::dim4, Dims::dim5, Dims::dim6, Dims::dim7 };
+
+      for ( int d = 0; d < 7; ++d )
+      {
+         if ( c.dim[d] != dim[d] )
+         {
+            throw quantity_error( "quantity: column file: column '" + c.name + "' has different dimensions" );
+         }
+      }
+      return c;
+   }
+
+   static std::size_t name_length( char const * const s, std::size_t const n )
+   {
+      std::size_t i = 0;
+      while ( i < n && s[i] )
+      {
+         ++i;
+      }
+      return i;
+   }
+
+   detail::mapped_file m_file;
+   std::vector< column_info > m_columns;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_COLUMN_FILE_HPP_INCLUDED
+
+/*
+ * end of file
+ */
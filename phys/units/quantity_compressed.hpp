@@ -0,0 +1,784 @@
+/**
+ * \file quantity_compressed.hpp
+ *
+ * \brief   Compressed time series of quantities, with delta-of-delta timestamps and XOR-coded values.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * compressed_series holds (timestamp, quantity) samples in the encoding of
+ * Facebook's Gorilla time series database: the delta of successive timestamp
+ * deltas in a variable-length code, and the XOR of successive values as the
+ * window of bits that differ. Regularly sampled, slowly varying signals take
+ * a few bits per sample instead of sixteen bytes:
+ *
+ *    compressed_series< pressure_d > s;
+ *
+ *    s.append( t, p );   // t: integer ticks, non-decreasing
+ *    ...
+ *    std::vector< std::int64_t > times;
+ *    std::vector< quantity< pressure_d > > values;
+ *
+ *    s.decode( t0, t1, times, values );   // samples with t0 <= t <= t1
+ *
+ * The samples are coded in blocks of block_size samples that start on a
+ * 64-bit word and are decoded on their own. An index of the first and last
+ * timestamp of each block lets decode( t0, t1, ... ) decode only the blocks
+ * that overlap the range.
+ *
+ * write() stores the series in a stream with a 64-byte header of magic
+ * "PHYSGOR", byte-order mark, version, the seven dimension exponents and
+ * the sizes, followed by the block index and the coded words, in native
+ * byte order. Reading it as a series of other dimensions throws
+ * quantity_error, as does a truncated stream or an index whose blocks do not
+ * fit the coded words. Decoding throws quantity_error for a value window that
+ * does not fit in 64 bits; other corrupt coded bits decode to garbage values,
+ * but never read past the coded words. Appending to a series read from a stream starts a new
+ * block.
+ *
+ * Values are double; they are restored bit for bit.
+ *
+ * This header requires C++11.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_COMPRESSED_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_COMPRESSED_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_compressed.hpp requires C++11 or later
+#endif
+
+#include <algorithm>    // for lower_bound
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t, uint64_t
+#include <cstring>      // for memcpy, memcmp
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * index entry of a block of a compressed series.
+ */
+struct compressed_block
+{
+   std::int64_t first;     // first timestamp
+   std::int64_t last;      // last timestamp
+   std::uint64_t offset;   // first word
+   std::uint64_t count;    // samples
+};
+
+namespace detail {
+
+/**
+ * stream header, 64 bytes.
+ */
+struct compressed_header
+{
+   char magic[8];
+   std::uint32_t byte_order;
+   std::uint32_t version;
+   signed char dim[8];
+   std::uint64_t block_size;
+   std::uint64_t samples;
+   std::uint64_t blocks;
+   std::uint64_t words;
+   std::uint64_t reserved;
+};
+
+static_assert( sizeof( compressed_header ) == 64, "compressed series header must be 64 bytes" );
+static_assert( sizeof( compressed_block ) == 32, "compressed series index entry must be 32 bytes" );
+
+char const compressed_magic[8] = "PHYSGOR";
+
+std::uint32_t const compressed_byte_order = 0x01020304u;
+
+/**
+ * number of leading zero bits of non-zero x.
+ */
+inline unsigned leading_zeros( std::uint64_t const x )
+{
+#if defined( __GNUC__ )
+   return static_cast< unsigned >( __builtin_clzll( x ) );
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+   unsigned long i;
+   _BitScanReverse64( &i, x );
+   return 63 - i;
+#else
+   unsigned n = 0;
+   for ( std::uint64_t m = std::uint64_t( 1 ) << 63; ! ( x & m ); m >>= 1 )
+   {
+      ++n;
+   }
+   return n;
+#endif
+}
+
+/**
+ * number of trailing zero bits of non-zero x.
+ */
+inline unsigned trailing_zeros( std::uint64_t const x )
+{
+#if defined( __GNUC__ )
+   return static_cast< unsigned >( __builtin_ctzll( x ) );
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+   unsigned long i;
+   _BitScanForward64( &i, x );
+   return i;
+#else
+   unsigned n = 0;
+   for ( std::uint64_t m = 1; ! ( x & m ); m <<= 1 )
+   {
+      ++n;
+   }
+   return n;
+#endif
+}
+
+/**
+ * n-bit two's complement v as a signed value.
+ */
+inline std::int64_t sign_extend( std::uint64_t const v, unsigned const n )
+{
+   return v > ( std::uint64_t( 1 ) << ( n - 1 ) ) ? static_cast< std::int64_t >( v ) - ( std::int64_t( 1 ) << n ) : static_cast< std::int64_t >( v );
+}
+
+/**
+ * reader of a most-significant-bit-first stream of 64-bit words.
+ */
+class bit_reader
+{
+public:
+   bit_reader( std::uint64_t const * const words, std::size_t const size )
+   : m_words( words )
+   , m_size( size )
+   , m_pos( 0 )
+   {
+   }
+
+   /**
+    * next 64 bits, zero-filled past the end, without consuming them.
+    */
+   std::uint64_t peek() const
+   {
+      std::size_t const w = m_pos >> 6;
+      unsigned const b = m_pos & 63;
+
+      if ( w >= m_size )
+      {
+         return 0;
+      }
+
+      std::uint64_t v = m_words[w] << b;
+      if ( b > 0 && w + 1 < m_size )
+      {
+         v |= m_words[ w + 1 ] >> ( 64 - b );
+      }
+      return v;
+   }
+
+   void skip( unsigned const n )
+   {
+      m_pos += n;
+   }
+
+   /**
+    * next n bits, 1 <= n <= 64.
+    */
+   std::uint64_t read( unsigned const n )
+   {
+      std::uint64_t const v = peek();
+      m_pos += n;
+      return n == 64 ? v : v >> ( 64 - n );
+   }
+
+private:
+   std::uint64_t const * m_words;
+   std::size_t m_size;
+   std::size_t m_pos;
+};
+
+/**
+ * read n values into v in pieces, so that a corrupt n fails at the end of
+ * the stream instead of allocating n values up front.
+ */
+template< typename T >
+inline bool read_values( std::istream & is, std::vector< T > & v, std::uint64_t const n )
+{
+   std::uint64_t const piece = ( 1 << 16 ) / sizeof( T );
+
+   v.clear();
+
+   while ( v.size() < n )
+   {
+      std::size_t const at = v.size();
+      std::size_t const k = static_cast< std::size_t >( n - at < piece ? n - at : piece );
+
+      v.resize( at + k );
+
+      if ( ! is.read( reinterpret_cast< char * >( &v[at] ), static_cast< std::streamsize >( k * sizeof( T ) ) ) )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+} // namespace detail
+
+/**
+ * compressed time series of quantities with dimensions Dims.
+ */
+template< typename Dims >
+class compressed_series
+{
+public:
+   typedef quantity< Dims, double > value_type;
+
+   enum { default_block_size = 1024 };
+
+   /**
+    * empty series, coded in blocks of block_size samples.
+    */
+   explicit compressed_series( std::size_t const block_size = default_block_size )
+   : m_block_size( block_size > 0 ? block_size : 1 )
+   , m_samples( 0 )
+   , m_bits( 0 )
+   , m_blocks()
+   , m_words()
+   , m_time( 0 )
+   , m_delta( 0 )
+   , m_value( 0 )
+   , m_leading( 64 )
+   , m_trailing( 0 )
+   , m_open( false )
+   {
+   }
+
+   /**
+    * series read from is, as written by write(); throws quantity_error if it
+    * is not a compressed series, has other dimensions, or is truncated or corrupt.
+    */
+   explicit compressed_series( std::istream & is )
+   : m_block_size( 0 )
+   , m_samples( 0 )
+   , m_bits( 0 )
+   , m_blocks()
+   , m_words()
+   , m_time( 0 )
+   , m_delta( 0 )
+   , m_value( 0 )
+   , m_leading( 64 )
+   , m_trailing( 0 )
+   , m_open( false )   // the coder state is not stored: the next sample starts a new block
+   {
+      detail::compressed_header h;
+      if ( ! is.read( reinterpret_cast< char * >( &h ), sizeof h ) )
+      {
+         throw quantity_error( "quantity: compressed series: stream is too short" );
+      }
+      if ( std::memcmp( h.magic, detail::compressed_magic, sizeof h.magic ) != 0 )
+      {
+         throw quantity_error( "quantity: compressed series: stream is not a compressed series" );
+      }
+      if ( h.byte_order != detail::compressed_byte_order )
+      {
+         throw quantity_error( "quantity: compressed series: stream has a different byte order" );
+      }
+      if ( h.version != 1 )
+      {
+         throw quantity_error( "quantity: compressed series: stream has an unsupported version" );
+      }
+
+      int const dim[7] = { Dims::dim1, Dims::dim2, Dims::dim3, Dims::dim4, Dims::dim5, Dims::dim6, Dims::dim7 };
+
+      for ( int d = 0; d < 7; ++d )
+      {
+         if ( h.dim[d] != dim[d] )
+         {
+            throw quantity_error( "quantity: compressed series: stream has different dimensions" );
+         }
+      }
+
+      m_block_size = static_cast< std::size_t >( h.block_size > 0 ? h.block_size : 1 );
+      m_samples = static_cast< std::size_t >( h.samples );
+
+      if ( ! detail::read_values( is, m_blocks, h.blocks ) || ! detail::read_values( is, m_words, h.words ) )
+      {
+         throw quantity_error( "quantity: compressed series: stream is truncated" );
+      }
+      m_bits = m_words.size() * 64;
+
+      // a block runs up to the next block or the end; its first sample takes
+      // 128 bits and every next sample at least 2
+
+      std::uint64_t samples = 0;
+      for ( std::size_t i = 0; i < m_blocks.size(); ++i )
+      {
+         compressed_block const & b = m_blocks[i];
+         std::uint64_t const end = i + 1 < m_blocks.size() ? m_blocks[i + 1].offset : m_words.size();
+
+         if ( b.count == 0 || b.count > m_block_size || b.first > b.last
+            || b.offset >= end || end > m_words.size() || ( end - b.offset ) * 64 < 128 + 2 * ( b.count - 1 )
+            || ( i > 0 && b.first < m_blocks[i - 1].last ) )
+         {
+            throw quantity_error( "quantity: compressed series: stream has an invalid block index" );
+         }
+         samples += b.count;
+      }
+      if ( samples != m_samples )
+      {
+         throw quantity_error( "quantity: compressed series: stream has an invalid block index" );
+      }
+   }
+
+   /**
+    * append sample v at time t; throws quantity_error if t precedes the last timestamp.
+    */
+   void append( std::int64_t const t, value_type const & v )
+   {
+      double const d = detail::value_of( v );
+      std::uint64_t bits;
+      std::memcpy( &bits, &d, sizeof bits );
+
+      if ( m_samples > 0 && t < m_blocks.back().last )
+      {
+         throw quantity_error( "quantity: compressed series: timestamps must not decrease" );
+      }
+
+      if ( ! m_open || m_blocks.back().count == m_block_size )
+      {
+         start_block( t, bits );
+      }
+      else
+      {
+         append_time( t );
+         append_value( bits );
+
+         compressed_block & b = m_blocks.back();
+         b.last = t;
+         ++b.count;
+      }
+      ++m_samples;
+   }
+
+   /**
+    * number of samples.
+    */
+   std::size_t size() const
+   {
+      return m_samples;
+   }
+
+   bool empty() const
+   {
+      return m_samples == 0;
+   }
+
+   /**
+    * maximum number of samples per block.
+    */
+   std::size_t block_size() const
+   {
+      return m_block_size;
+   }
+
+   /**
+    * number of blocks.
+    */
+   std::size_t block_count() const
+   {
+      return m_blocks.size();
+   }
+
+   /**
+    * index entry of block i.
+    */
+   compressed_block const & block( std::size_t const i ) const
+   {
+      return m_blocks.at( i );
+   }
+
+   /**
+    * size of the coded samples in bytes, without header and index.
+    */
+   std::size_t bytes() const
+   {
+      return m_words.size() * sizeof( std::uint64_t );
+   }
+
+   /**
+    * append the samples of block i to times and values; throws quantity_error
+    * if its coded values are corrupt.
+    */
+   void decode_block( std::size_t const i, std::vector< std::int64_t > & times, std::vector< value_type > & values ) const
+   {
+      compressed_block const & b = m_blocks.at( i );
+
+      std::size_t const n = static_cast< std::size_t >( b.count );
+      std::size_t const at = times.size();
+
+      times.resize( at + n );
+      values.resize( at + n );
+
+      decode_block( b, &times[at], &values[at] );
+   }
+
+   /**
+    * append all samples to times and values; throws quantity_error if coded
+    * values are corrupt.
+    */
+   void decode( std::vector< std::int64_t > & times, std::vector< value_type > & values ) const
+   {
+      std::size_t const at = times.size();
+
+      times.resize( at + m_samples );
+      values.resize( at + m_samples );
+
+      std::size_t k = at;
+      for ( std::size_t i = 0; i < m_blocks.size(); ++i )
+      {
+         decode_block( m_blocks[i], &times[k], &values[k] );
+         k += static_cast< std::size_t >( m_blocks[i].count );
+      }
+   }
+
+   /**
+    * append the samples with t0 <= t <= t1 to times and values, decoding
+    * only the blocks that overlap the range; returns the number of samples.
+    */
+   std::size_t decode( std::int64_t const t0, std::int64_t const t1, std::vector< std::int64_t > & times, std::vector< value_type > & values ) const
+   {
+      std::size_t const at = times.size();
+
+      for ( std::size_t i = first_block( t0 ); i < m_blocks.size() && m_blocks[i].first <= t1; ++i )
+      {
+         std::size_t const from = times.size();
+
+         decode_block( i, times, values );
+
+         // keep the samples in range; timestamps are sorted
+
+         std::size_t const lo = std::lower_bound( times.begin() + from, times.end(), t0 ) - times.begin();
+         std::size_t const hi = std::upper_bound( times.begin() + lo, times.end(), t1 ) - times.begin();
+
+         times.erase( times.begin() + hi, times.end() );
+         values.erase( values.begin() + hi, values.end() );
+         times.erase( times.begin() + from, times.begin() + lo );
+         values.erase( values.begin() + from, values.begin() + lo );
+      }
+      return times.size() - at;
+   }
+
+   /**
+    * index of the first block with samples at or after t.
+    */
+   std::size_t first_block( std::int64_t const t ) const
+   {
+      std::size_t lo = 0;
+      std::size_t hi = m_blocks.size();
+
+      while ( lo < hi )
+      {
+         std::size_t const mid = lo + ( hi - lo ) / 2;
+         if ( m_blocks[mid].last < t )
+         {
+            lo = mid + 1;
+         }
+         else
+         {
+            hi = mid;
+         }
+      }
+      return lo;
+   }
+
+   /**
+    * write the series to os; throws quantity_error on failure.
+    */
+   void write( std::ostream & os ) const
+   {
+      detail::compressed_header h = detail::compressed_header();
+      std::memcpy( h.magic, detail::compressed_magic, sizeof h.magic );
+      h.byte_order = detail::compressed_byte_order;
+      h.version = 1;
+      h.dim[0] = Dims::dim1;
+      h.dim[1] = Dims::dim2;
+      h.dim[2] = Dims::dim3;
+      h.dim[3] = Dims::dim4;
+      h.dim[4] = Dims::dim5;
+      h.dim[5] = Dims::dim6;
+      h.dim[6] = Dims::dim7;
+      h.block_size = m_block_size;
+      h.samples = m_samples;
+      h.blocks = m_blocks.size();
+      h.words = m_words.size();
+
+      os.write( reinterpret_cast< char const * >( &h ), sizeof h );
+      if ( ! m_blocks.empty() )
+      {
+         os.write( reinterpret_cast< char const * >( &m_blocks[0] ), m_blocks.size() * sizeof( compressed_block ) );
+      }
+      if ( ! m_words.empty() )
+      {
+         os.write( reinterpret_cast< char const * >( &m_words[0] ), m_words.size() * sizeof( std::uint64_t ) );
+      }
+      if ( ! os.flush() )
+      {
+         throw quantity_error( "quantity: compressed series: cannot write stream" );
+      }
+   }
+
+private:
+   /**
+    * start a block at the next word with the uncoded sample (t, bits).
+    */
+   void start_block( std::int64_t const t, std::uint64_t const bits )
+   {
+      m_bits = ( m_bits + 63 ) / 64 * 64;
+
+      compressed_block b;
+      b.first = t;
+      b.last = t;
+      b.offset = m_bits / 64;
+      b.count = 1;
+      m_blocks.push_back( b );
+
+      put( static_cast< std::uint64_t >( t ), 64 );
+      put( bits, 64 );
+
+      m_time = t;
+      m_delta = 0;
+      m_value = bits;
+      m_leading = 64;
+      m_trailing = 0;
+      m_open = true;
+   }
+
+   /**
+    * code the delta of deltas: 0; 10 and 7 bits; 110 and 9 bits; 1110 and 12 bits; 1111 and 64 bits.
+    */
+   void append_time( std::int64_t const t )
+   {
+      std::int64_t const delta = static_cast< std::int64_t >( static_cast< std::uint64_t >( t ) - static_cast< std::uint64_t >( m_time ) );
+      std::int64_t const dod = static_cast< std::int64_t >( static_cast< std::uint64_t >( delta ) - static_cast< std::uint64_t >( m_delta ) );
+      std::uint64_t const u = static_cast< std::uint64_t >( dod );
+
+      if ( dod == 0 )
+      {
+         put( 0, 1 );
+      }
+      else if ( dod >= -63 && dod <= 64 )
+      {
+         put( ( std::uint64_t( 0x2 ) << 7 ) | ( u & 0x7f ), 9 );
+      }
+      else if ( dod >= -255 && dod <= 256 )
+      {
+         put( ( std::uint64_t( 0x6 ) << 9 ) | ( u & 0x1ff ), 12 );
+      }
+      else if ( dod >= -2047 && dod <= 2048 )
+      {
+         put( ( std::uint64_t( 0xe ) << 12 ) | ( u & 0xfff ), 16 );
+      }
+      else
+      {
+         put( 0xf, 4 );
+         put( u, 64 );
+      }
+      m_time = t;
+      m_delta = delta;
+   }
+
+   /**
+    * code the XOR with the previous value: 0 if equal; 10 and the bits in
+    * the previous window; 11, 5 bits leading zeros, 6 bits length - 1 and
+    * the bits in a new window.
+    */
+   void append_value( std::uint64_t const bits )
+   {
+      std::uint64_t const x = bits ^ m_value;
+
+      if ( x == 0 )
+      {
+         put( 0, 1 );
+      }
+      else
+      {
+         unsigned leading = detail::leading_zeros( x );
+         unsigned const trailing = detail::trailing_zeros( x );
+
+         if ( leading > 31 )
+         {
+            leading = 31;
+         }
+
+         if ( m_leading <= leading && m_trailing <= trailing )
+         {
+            put( 0x2, 2 );
+            put( x >> m_trailing, 64 - m_leading - m_trailing );
+         }
+         else
+         {
+            unsigned const length = 64 - leading - trailing;
+
+            put( ( ( std::uint64_t( 0x3 ) << 5 | leading ) << 6 ) | ( length - 1 ), 13 );
+            put( x >> trailing, length );
+
+            m_leading = leading;
+            m_trailing = trailing;
+         }
+      }
+      m_value = bits;
+   }
+
+   /**
+    * append the low n bits of v, 1 <= n <= 64.
+    */
+   void put( std::uint64_t const v, unsigned const n )
+   {
+      unsigned const used = m_bits & 63;
+
+      if ( used == 0 )
+      {
+         m_words.push_back( 0 );
+      }
+      if ( n <= 64 - used )
+      {
+         m_words.back() |= v << ( 64 - used - n );
+      }
+      else
+      {
+         unsigned const rest = n - ( 64 - used );
+
+         m_words.back() |= v >> rest;
+         m_words.push_back( v << ( 64 - rest ) );
+      }
+      m_bits += n;
+   }
+
+   void decode_block( compressed_block const & b, std::int64_t * const times, value_type * const values ) const
+   {
+      std::size_t const offset = static_cast< std::size_t >( b.offset );
+
+      detail::bit_reader in( &m_words[offset], m_words.size() - offset );
+
+      std::int64_t t = static_cast< std::int64_t >( in.read( 64 ) );
+      std::uint64_t bits = in.read( 64 );
+      std::uint64_t delta = 0;
+      unsigned leading = 0;
+      unsigned length = 64;
+
+      times[0] = t;
+      values[0] = make_value( bits );
+
+      std::size_t const n = static_cast< std::size_t >( b.count );
+      for ( std::size_t k = 1; k < n; ++k )
+      {
+         // the control bits and short fields come from one look at the next 64 bits
+
+         std::uint64_t x = in.peek();
+
+         if ( x >> 63 )
+         {
+            unsigned const ones = ~x ? detail::leading_zeros( ~x ) : 64;
+
+            if ( ones == 1 )
+            {
+               delta += static_cast< std::uint64_t >( detail::sign_extend( x >> 55 & 0x7f, 7 ) );
+               in.skip( 9 );
+            }
+            else if ( ones == 2 )
+            {
+               delta += static_cast< std::uint64_t >( detail::sign_extend( x >> 52 & 0x1ff, 9 ) );
+               in.skip( 12 );
+            }
+            else if ( ones == 3 )
+            {
+               delta += static_cast< std::uint64_t >( detail::sign_extend( x >> 48 & 0xfff, 12 ) );
+               in.skip( 16 );
+            }
+            else
+            {
+               in.skip( 4 );
+               delta += in.read( 64 );
+            }
+            x = in.peek();
+         }
+         else
+         {
+            in.skip( 1 );
+            x <<= 1;
+         }
+         t = static_cast< std::int64_t >( static_cast< std::uint64_t >( t ) + delta );
+
+         if ( x >> 63 )
+         {
+            if ( x >> 62 & 1 )
+            {
+               leading = static_cast< unsigned >( x >> 57 & 0x1f );
+               length = static_cast< unsigned >( x >> 51 & 0x3f ) + 1;
+               in.skip( 13 );
+
+               if ( leading + length > 64 )
+               {
+                  throw quantity_error( "quantity: compressed series: block has corrupt coded values" );
+               }
+            }
+            else
+            {
+               in.skip( 2 );
+            }
+            bits ^= in.read( length ) << ( 64 - leading - length );
+         }
+         else
+         {
+            in.skip( 1 );
+         }
+
+         times[k] = t;
+         values[k] = make_value( bits );
+      }
+   }
+
+   static value_type make_value( std::uint64_t const bits )
+   {
+      double d;
+      std::memcpy( &d, &bits, sizeof d );
+      return value_type( detail::permit< double >( d ) );
+   }
+
+   std::size_t m_block_size;
+   std::size_t m_samples;
+   std::size_t m_bits;
+   std::vector< compressed_block > m_blocks;
+   std::vector< std::uint64_t > m_words;
+
+   // coder state of the open block
+
+   std::int64_t m_time;
+   std::int64_t m_delta;
+   std::uint64_t m_value;
+   unsigned m_leading;
+   unsigned m_trailing;
+   bool m_open;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_COMPRESSED_HPP_INCLUDED
+
+/*
+ * end of file
+ */
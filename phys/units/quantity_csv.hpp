@@ -0,0 +1,749 @@
+/**
+ * \file quantity_csv.hpp
+ *
+ * \brief   Streaming CSV reader and writer for columns of quantities with unit headers.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * The first line of a file names the columns, each with its unit in square
+ * brackets, e.g. "time [s],power [kW],flow [m3/h]". csv_reader parses the
+ * units once, with parse_unit_expression(), and reads the rows in chunks
+ * into column buffers of the caller, converting each value to SI:
+ *
+ *    std::ifstream is( "plant.csv" );
+ *    csv_reader r( is );
+ *
+ *    std::vector< quantity< time_interval_d > > time;
+ *    std::vector< quantity< power_d > > power;
+ *
+ *    r.bind( "time", time );
+ *    r.bind( "power", power );                 // checks the dimensions of [kW]
+ *
+ *    while ( r.read() > 0 )
+ *    {
+ *       process( time, power );                // the rows of this chunk
+ *    }
+ *
+ * Columns that are not bound are skipped without parsing, and may have a
+ * unit the parser does not know. A column without a unit is dimensionless
+ * and binds to a std::vector of an arithmetic type. Empty fields read as NaN;
+ * in a column bound to an integral type, empty fields and values outside the
+ * range of the type throw quantity_error, with the row number.
+ *
+ * read() takes the next chunk of about chunk_bytes, ending at a line break,
+ * and resizes the buffers to its rows; after the first chunks the buffers
+ * have their capacity, and reading allocates no more. With threads > 1,
+ * the chunk is split at line breaks and the parts are parsed in parallel,
+ * each into its own range of rows. Numbers are parsed with std::from_chars
+ * where available (C++17), otherwise with strtod().
+ *
+ * Header fields may be quoted; data fields are unquoted numbers, with
+ * optional blanks around them; a blank field reads as empty. Lines
+ * may end in "\r\n". Malformed numbers, a wrong number of fields and
+ * dimension mismatches throw quantity_error, with the row number.
+ *
+ * csv_writer writes columns of quantities with a unit header: in SI with
+ * the symbol of to_unit_symbol(), in a given unit, or with an engineering
+ * prefix chosen by eng_format for the column's largest magnitude:
+ *
+ *    csv_writer w;
+ *    w.add( "time", &t[0], n );                // time [s]
+ *    w.add( "flow", &f[0], n, "m3/h" );        // flow [m3/h]
+ *    w.add_eng( "power", &p[0], n );           // power [kW], with the symbols of io.hpp
+ *    w.write( os );
+ *
+ * Values are written with the shortest representation that reads back
+ * to the same double (std::to_chars, or 17 significant digits before C++17).
+ *
+ * This header requires C++11 (std::thread).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_CSV_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_CSV_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_io_engineering.hpp"
+#include "phys/units/quantity_unit_parser.hpp"
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_csv.hpp requires C++11 or later
+#endif
+
+#include <cctype>   // for isspace
+#include <cmath>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <cstdio>   // for snprintf
+#include <cstdlib>  // for strtod
+#include <cstring>  // for memchr, memmove
+#include <exception>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef PHYS_UNITS_CPP17_OR_GREATER
+# include <charconv>
+#endif
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * true for a blank around a data field.
+ */
+inline bool csv_blank( char const c )
+{
+   return c == ' ' || c == '\t';
+}
+
+/**
+ * the number in [first, last), blanks around it skipped; false if it is not
+ * a number. The field ends at a delimiter or line break.
+ */
+inline bool csv_parse( char const * first, char const * last, double & value )
+{
+   while ( first < last && csv_blank( *first ) )
+   {
+      ++first;
+   }
+   while ( last > first && csv_blank( last[-1] ) )
+   {
+      --last;
+   }
+   if ( first == last )
+   {
+      value = std::numeric_limits<double>::quiet_NaN();
+      return true;
+   }
+#if defined( PHYS_UNITS_CPP17_OR_GREATER ) && defined( __cpp_lib_to_chars )
+   char const * p = first + ( *first == '+' && last - first > 1 );
+   std::from_chars_result const r = std::from_chars( p, last, value );
+   return r.ec == std::errc() && r.ptr == last;
+#else
+   // strtod() would skip other white space, which from_chars() rejects
+
+   if ( std::isspace( static_cast< unsigned char >( *first ) ) )
+   {
+      return false;
+   }
+   char * end = 0;
+   value = std::strtod( first, &end );
+   return end == last;
+#endif
+}
+
+/**
+ * value formatted into buf, shortest round-trip representation; returns the end.
+ */
+inline char * csv_format( char * const buf, std::size_t const size, double const value )
+{
+#if defined( PHYS_UNITS_CPP17_OR_GREATER ) && defined( __cpp_lib_to_chars )
+   return std::to_chars( buf, buf + size, value ).ptr;
+#else
+   int const n = std::snprintf( buf, size, "%.17g", value );
+   return buf + ( n < 0 ? 0 : n );
+#endif
+}
+
+/**
+ * the header field without quotes and surrounding blanks.
+ */
+inline std::string csv_trim( std::string const & s )
+{
+   std::size_t b = s.find_first_not_of( " \t\r" );
+   std::size_t e = s.find_last_not_of( " \t\r" );
+
+   if ( b == std::string::npos )
+   {
+      return std::string();
+   }
+   if ( e > b && s[b] == '"' && s[e] == '"' )
+   {
+      return csv_trim( s.substr( b + 1, e - b - 1 ) );
+   }
+   return s.substr( b, e - b + 1 );
+}
+
+} // namespace detail
+
+/**
+ * streaming reader of CSV columns into buffers of quantities.
+ */
+class csv_reader
+{
+public:
+   /**
+    * reader of is; reads and parses the header line.
+    */
+   explicit csv_reader( std::istream & is, char const delimiter = ',', unsigned const threads = 1, std::size_t const chunk_bytes = 1 << 22 )
+   : m_is( is )
+   , m_delimiter( delimiter )
+   , m_threads( threads < 1 ? 1 : threads )
+   , m_buffer( chunk_bytes < 1024 ? 1024 : chunk_bytes )
+   , m_pending( 0 )
+   , m_eof( false )
+   , m_rows( 0 )
+   {
+      std::string header;
+      if ( ! std::getline( m_is, header ) )
+      {
+         throw quantity_error( "quantity: csv: missing header line" );
+      }
+
+      std::istringstream fields( header );
+      std::string field;
+      while ( std::getline( fields, field, m_delimiter ) )
+      {
+         add_column( detail::csv_trim( field ) );
+      }
+      m_binding.assign( m_names.size(), -1 );
+   }
+
+   csv_reader( csv_reader const & ) = delete;
+   csv_reader & operator=( csv_reader const & ) = delete;
+
+   /**
+    * number of columns.
+    */
+   std::size_t size() const
+   {
+      return m_names.size();
+   }
+
+   std::string const & name( std::size_t const i ) const
+   {
+      return m_names.at( i );
+   }
+
+   /**
+    * unit of column i as written in the header, empty if none.
+    */
+   std::string const & unit( std::size_t const i ) const
+   {
+      return m_units.at( i );
+   }
+
+   /**
+    * index of the column with the given name; throws quantity_error if there is none.
+    */
+   std::size_t find( std::string const & name ) const
+   {
+      for ( std::size_t i = 0; i < m_names.size(); ++i )
+      {
+         if ( m_names[i] == name )
+         {
+            return i;
+         }
+      }
+      throw quantity_error( "quantity: csv: no column '" + name + "'" );
+   }
+
+   /**
+    * read column name into buffer, converted to SI; throws quantity_error if its unit does not have dimensions Dims.
+    */
+   template< typename Dims, typename T >
+   void bind( std::string const & name, std::vector< quantity< Dims, T > > & buffer )
+   {
+      std::size_t const i = find_bindable( name, dimension_code< Dims >::value );
+
+      add_binding( i, &buffer, &resize< std::vector< quantity< Dims, T > > >, &store< Dims, T > );
+   }
+
+   /**
+    * read dimensionless column name into buffer; throws quantity_error if its unit has dimensions.
+    */
+   template< typename T >
+   void bind( std::string const & name, std::vector< T > & buffer )
+   {
+      static_assert( std::is_arithmetic<T>::value, "dimensionless columns bind to an arithmetic type" );
+
+      std::size_t const i = find_bindable( name, 0 );
+
+      add_binding( i, &buffer, &resize< std::vector< T > >, &store< dimensionless_d, T > );
+   }
+
+   /**
+    * read the next chunk of rows into the bound buffers; returns the number of rows, 0 at the end.
+    */
+   std::size_t read()
+   {
+      std::size_t const end = fill();
+
+      if ( end == 0 )
+      {
+         return 0;
+      }
+
+      // split at line breaks into parts of about equal size, and count their rows
+
+      unsigned const parts = m_threads;
+      std::vector< std::size_t > begin( parts + 1, end );
+      std::vector< std::size_t > rows( parts + 1, 0 );
+
+      begin[0] = 0;
+      for ( unsigned k = 1; k < parts; ++k )
+      {
+         std::size_t const target = end / parts * k;
+         char const * const nl = static_cast< char const * >(
+            std::memchr( &m_buffer[0] + target, '\n', end - target ) );
+         begin[k] = nl ? static_cast< std::size_t >( nl - &m_buffer[0] ) + 1 : end;
+         begin[k] = begin[k] < begin[k - 1] ? begin[k - 1] : begin[k];
+      }
+      for ( unsigned k = 0; k < parts; ++k )
+      {
+         rows[k + 1] = rows[k] + count_rows( begin[k], begin[k + 1] );
+      }
+
+      std::size_t const n = rows[parts];
+
+      std::vector< void * > data( m_bindings.size() );
+      for ( std::size_t b = 0; b < m_bindings.size(); ++b )
+      {
+         data[b] = m_bindings[b].resize( m_bindings[b].buffer, n );
+      }
+
+      std::vector< std::exception_ptr > errors( parts );
+
+      if ( parts == 1 )
+      {
+         parse( begin[0], begin[1], 0, data, errors[0] );
+      }
+      else
+      {
+         std::vector< std::thread > workers;
+         for ( unsigned k = 1; k < parts; ++k )
+         {
+            workers.push_back( std::thread( &csv_reader::parse, this, begin[k], begin[k + 1], rows[k], std::cref( data ), std::ref( errors[k] ) ) );
+         }
+         parse( begin[0], begin[1], 0, data, errors[0] );
+
+         for ( std::size_t k = 0; k < workers.size(); ++k )
+         {
+            workers[k].join();
+         }
+      }
+
+      for ( unsigned k = 0; k < parts; ++k )
+      {
+         if ( errors[k] )
+         {
+            std::rethrow_exception( errors[k] );
+         }
+      }
+
+      m_pending -= end;
+      std::memmove( &m_buffer[0], &m_buffer[0] + end, m_pending );
+
+      m_rows += n;
+      return n;
+   }
+
+   /**
+    * number of rows read so far.
+    */
+   std::uint64_t rows() const
+   {
+      return m_rows;
+   }
+
+private:
+   struct binding
+   {
+      void * buffer;
+      void * (*resize)( void *, std::size_t );
+      bool (*store)( void *, std::size_t, double );
+      double scale;
+   };
+
+   template< typename Vector >
+   static void * resize( void * const buffer, std::size_t const n )
+   {
+      Vector & v = *static_cast< Vector * >( buffer );
+      v.resize( n );
+      return n > 0 ? &v[0] : 0;
+   }
+
+   /**
+    * store value in row; false if T is integral and value is NaN or outside its range.
+    */
+   template< typename Dims, typename T >
+   static bool store( void * const data, std::size_t const row, double const value )
+   {
+      typedef typename detail::collapse< Dims, T >::type value_type;
+
+      if ( std::is_integral<T>::value &&
+         ! ( value > static_cast< double >( std::numeric_limits<T>::lowest() ) - 1 &&
+             value < static_cast< double >( ( std::numeric_limits<T>::max )() ) + 1 ) )
+      {
+         return false;
+      }
+      static_cast< value_type * >( data )[row] = detail::from_value< Dims >( static_cast<T>( value ) );
+      return true;
+   }
+
+   /**
+    * add the column of header field "name [unit]"; a unit that does not parse gets factor 0 and cannot be bound.
+    */
+   void add_column( std::string const & field )
+   {
+      std::size_t const open = field.find( '[' );
+      std::size_t const close = field.rfind( ']' );
+
+      unit_expression u = { 0, 1 };
+
+      if ( open != std::string::npos && close != std::string::npos && close > open )
+      {
+         m_names.push_back( detail::csv_trim( field.substr( 0, open ) ) );
+         m_units.push_back( detail::csv_trim( field.substr( open + 1, close - open - 1 ) ) );
+
+         if ( ! m_units.back().empty() )
+         {
+            try
+            {
+               u = parse_unit_expression( m_units.back() );
+            }
+            catch ( quantity_error const & )
+            {
+               u.factor = 0;
+            }
+         }
+      }
+      else
+      {
+         m_names.push_back( field );
+         m_units.push_back( std::string() );
+      }
+      m_expressions.push_back( u );
+   }
+
+   /**
+    * index of column name, checked to have a known unit with dimension code.
+    */
+   std::size_t find_bindable( std::string const & name, long long const code ) const
+   {
+      std::size_t const i = find( name );
+
+      if ( m_expressions[i].factor == 0 )
+      {
+         throw quantity_error( "quantity: csv: unknown unit [" + m_units[i] + "] of column '" + name + "'" );
+      }
+      if ( m_expressions[i].code != code )
+      {
+         throw quantity_error( "quantity: csv: unit [" + m_units[i] + "] of column '" + name + "' has other dimensions" );
+      }
+      return i;
+   }
+
+   void add_binding( std::size_t const i, void * const buffer, void * (*resize)( void *, std::size_t ), bool (*store)( void *, std::size_t, double ) )
+   {
+      binding const b = { buffer, resize, store, static_cast< double >( m_expressions[i].factor ) };
+
+      if ( m_binding[i] >= 0 )
+      {
+         m_bindings[ static_cast< std::size_t >( m_binding[i] ) ] = b;
+      }
+      else
+      {
+         m_binding[i] = static_cast< int >( m_bindings.size() );
+         m_bindings.push_back( b );
+      }
+   }
+
+   /**
+    * read from the stream until the buffer holds a line break; returns the end of the last complete line.
+    */
+   std::size_t fill()
+   {
+      for ( ;; )
+      {
+         if ( ! m_eof && m_pending < m_buffer.size() )
+         {
+            m_is.read( &m_buffer[0] + m_pending, static_cast< std::streamsize >( m_buffer.size() - m_pending ) );
+            m_pending += static_cast< std::size_t >( m_is.gcount() );
+            m_eof = ! m_is;
+         }
+         if ( m_eof && m_pending > 0 && m_buffer[m_pending - 1] != '\n' )
+         {
+            if ( m_pending == m_buffer.size() )
+            {
+               m_buffer.resize( 2 * m_buffer.size() );
+            }
+            m_buffer[m_pending++] = '\n';
+         }
+         for ( std::size_t i = m_pending; i > 0; --i )
+         {
+            if ( m_buffer[i - 1] == '\n' )
+            {
+               return i;
+            }
+         }
+         if ( m_eof )
+         {
+            return 0;
+         }
+         m_buffer.resize( 2 * m_buffer.size() );   // a line longer than the buffer
+      }
+   }
+
+   /**
+    * true if the line [b, e) holds no fields.
+    */
+   static bool blank( char const * const b, char const * const e )
+   {
+      return e == b || ( e == b + 1 && *b == '\r' );
+   }
+
+   std::size_t count_rows( std::size_t b, std::size_t const e ) const
+   {
+      std::size_t n = 0;
+      char const * const base = &m_buffer[0];
+
+      while ( b < e )
+      {
+         char const * const nl = static_cast< char const * >( std::memchr( base + b, '\n', e - b ) );
+         n += ! blank( base + b, nl );
+         b = static_cast< std::size_t >( nl - base ) + 1;
+      }
+      return n;
+   }
+
+   /**
+    * parse the lines in [b, e) into rows from row on; stores the first error.
+    */
+   void parse( std::size_t b, std::size_t const e, std::size_t row, std::vector< void * > const & data, std::exception_ptr & error ) const
+   {
+      try
+      {
+         char const * const base = &m_buffer[0];
+         std::size_t const columns = m_names.size();
+
+         while ( b < e )
+         {
+            char const * p = base + b;
+            char const * const nl = static_cast< char const * >( std::memchr( p, '\n', e - b ) );
+            char const * const end = nl > p && nl[-1] == '\r' ? nl - 1 : nl;
+
+            b = static_cast< std::size_t >( nl - base ) + 1;
+
+            if ( blank( p, nl ) )
+            {
+               continue;
+            }
+
+            for ( std::size_t c = 0; c < columns; ++c )
+            {
+               char const * q = p;
+               while ( q < end && *q != m_delimiter )
+               {
+                  ++q;
+               }
+               if ( q == end && c + 1 < columns )
+               {
+                  fail( row, "too few fields" );
+               }
+
+               int const k = m_binding[c];
+               if ( k >= 0 )
+               {
+                  double value;
+                  if ( ! detail::csv_parse( p, q, value ) )
+                  {
+                     fail( row, "malformed number in column '" + m_names[c] + "'" );
+                  }
+                  binding const & bd = m_bindings[ static_cast< std::size_t >( k ) ];
+                  if ( ! bd.store( data[ static_cast< std::size_t >( k ) ], row, value * bd.scale ) )
+                  {
+                     fail( row, "empty or out-of-range value in integral column '" + m_names[c] + "'" );
+                  }
+               }
+               p = q + 1;
+            }
+            if ( p <= end )
+            {
+               fail( row, "too many fields" );
+            }
+            ++row;
+         }
+      }
+      catch ( ... )
+      {
+         error = std::current_exception();
+      }
+   }
+
+   void fail( std::size_t const row, std::string const & text ) const
+   {
+      std::ostringstream os;
+      os << "quantity: csv: data row " << m_rows + row + 1 << ": " << text;
+      throw quantity_error( os.str() );
+   }
+
+   std::istream & m_is;
+   char m_delimiter;
+   unsigned m_threads;
+   std::vector< char > m_buffer;
+   std::size_t m_pending;
+   bool m_eof;
+   std::uint64_t m_rows;
+
+   std::vector< std::string > m_names;
+   std::vector< std::string > m_units;
+   std::vector< unit_expression > m_expressions;
+   std::vector< int > m_binding;        // per column, index in m_bindings or -1
+   std::vector< binding > m_bindings;
+};
+
+/**
+ * writer of CSV columns of quantities with a unit header.
+ */
+class csv_writer
+{
+public:
+   explicit csv_writer( char const delimiter = ',' )
+   : m_delimiter( delimiter )
+   , m_columns()
+   {
+   }
+
+   /**
+    * add column name with the n quantities at data, in SI; data must remain valid until write().
+    */
+   template< typename Dims, typename T >
+   void add( std::string const & name, quantity< Dims, T > const * const data, std::size_t const n )
+   {
+      add_column< Dims, T >( name, data, n, to_unit_symbol( quantity< Dims, T >() ), 1 );
+   }
+
+   /**
+    * add column name in the given unit; throws quantity_error if unit does not have dimensions Dims.
+    */
+   template< typename Dims, typename T >
+   void add( std::string const & name, quantity< Dims, T > const * const data, std::size_t const n, std::string const & unit )
+   {
+      unit_expression const u = parse_unit_expression( unit );
+
+      if ( ! has_dimensions< Dims >( u ) )
+      {
+         throw quantity_error( "quantity: csv: unit [" + unit + "] of column '" + name + "' has other dimensions" );
+      }
+      add_column< Dims, T >( name, data, n, unit, static_cast< double >( u.factor ) );
+   }
+
+   /**
+    * add column name in the engineering unit of its largest magnitude, e.g. kW.
+    */
+   template< typename Dims, typename T >
+   void add_eng( std::string const & name, quantity< Dims, T > const * const data, std::size_t const n )
+   {
+      T largest = T( 0 );
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         T const v = std::abs( detail::value_of( data[i] ) );
+         largest = v > largest ? v : largest;
+      }
+
+      std::string unit = largest > T( 0 ) && largest == largest
+         ? eng_format< Dims, T >( quantity< Dims, T >( detail::permit<T>( largest ) ) ).unit()
+         : to_unit_symbol( quantity< Dims, T >() );
+
+      std::string const micro( PHYS_UNITS_MICRO_GLYPH );
+      if ( unit.compare( 0, micro.size(), micro ) == 0 )
+      {
+         unit.replace( 0, micro.size(), "u" );
+      }
+      add< Dims, T >( name, data, n, unit );
+   }
+
+   /**
+    * write the header and all rows to os; throws quantity_error if the columns differ in length.
+    */
+   void write( std::ostream & os ) const
+   {
+      std::size_t const n = m_columns.empty() ? 0 : m_columns[0].rows;
+
+      for ( std::size_t c = 0; c < m_columns.size(); ++c )
+      {
+         if ( m_columns[c].rows != n )
+         {
+            throw quantity_error( "quantity: csv: column '" + m_columns[c].name + "' differs in length" );
+         }
+         os << ( c ? std::string( 1, m_delimiter ) : std::string() ) << m_columns[c].name << " [" << m_columns[c].unit << "]";
+      }
+      os << '\n';
+
+      std::vector< char > line( 32 * ( m_columns.size() + 1 ) );
+
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         char * p = &line[0];
+         for ( std::size_t c = 0; c < m_columns.size(); ++c )
+         {
+            if ( c )
+            {
+               *p++ = m_delimiter;
+            }
+            column const & col = m_columns[c];
+            double const v = col.value( col.data, i ) / col.scale;
+
+            if ( v == v )   // NaN as empty field
+            {
+               p = detail::csv_format( p, 32, v );
+            }
+         }
+         *p++ = '\n';
+         os.write( &line[0], p - &line[0] );
+      }
+
+      if ( ! os )
+      {
+         throw quantity_error( "quantity: csv: write failed" );
+      }
+   }
+
+private:
+   struct column
+   {
+      std::string name;
+      std::string unit;
+      void const * data;
+      std::size_t rows;
+      double (*value)( void const *, std::size_t );
+      double scale;
+   };
+
+   template< typename Dims, typename T >
+   static double value( void const * const data, std::size_t const i )
+   {
+      return static_cast< double >( detail::value_of( static_cast< quantity< Dims, T > const * >( data )[i] ) );
+   }
+
+   template< typename Dims, typename T >
+   void add_column( std::string const & name, quantity< Dims, T > const * const data, std::size_t const n, std::string const & unit, double const scale )
+   {
+      column const c = { name, unit, data, n, &value< Dims, T >, scale };
+      m_columns.push_back( c );
+   }
+
+   char m_delimiter;
+   std::vector< column > m_columns;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_CSV_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,487 @@
+/**
+ * \file quantity_dual.hpp
+ *
+ * \brief   Dual-number representation type for forward-mode automatic differentiation.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * dual<T, N> carries a value and its partial derivatives with respect to N
+ * seed variables. A model written for quantity< Dims > evaluates with
+ * quantity< Dims, dual<T, N> > in one pass to the value and the gradient:
+ *
+ *    quantity< length_d, dual<Rep, 2> > x = seed<2>( 0.1 * meter(), 0 );
+ *    quantity< mass_d,   dual<Rep, 2> > m = seed<2>( 2.0 * kilogram(), 1 );
+ *
+ *    quantity< energy_d, dual<Rep, 2> > e = m * x * 9.81 * meter() / second() / second();
+ *
+ *    quantity< force_d > dedx = derivative< length_d >( e, 0 );
+ *    quantity< energy_d > e0  = primal( e );
+ *
+ * The derivative components are stored in coherent SI units; derivative()
+ * returns component i with the dimensions of the result divided by those
+ * of seed variable i. With seed<N>(), those dimensions are the caller's
+ * XDims and are not checked. From C++11, dual<T, N, Seeds> records them in
+ * a dimension_list instead, and the seed and the derivative are checked at
+ * compile time:
+ *
+ *    typedef dimension_list< length_d, mass_d > seeds;
+ *
+ *    quantity< length_d, dual<Rep, 2, seeds> > x = seed< seeds, 0 >( 0.1 * meter() );
+ *    quantity< mass_d,   dual<Rep, 2, seeds> > m = seed< seeds, 1 >( 2.0 * kilogram() );
+ *    ...
+ *    quantity< force_d > dedx = derivative< 0 >( e );
+ *
+ * A dual times a quantity of T is a dual quantity. The components lie
+ * contiguous after the value and the loops over them are unrolled at compile
+ * time, so that the compiler keeps them in registers and can vectorise them,
+ * also at -O2.
+ *
+ * The math functions and operator<< are found for dual by argument-dependent
+ * lookup, so that nth_power(), nth_root(), sqrt(), abs(), fma(), hypot() and
+ * io:: output of quantities work. Comparisons use the values only.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_DUAL_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_DUAL_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <cmath>
+#include <cstddef>  // for size_t
+#include <ostream>
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * element-wise operations on derivative arrays, elements I..N-1, unrolled.
+ */
+template< std::size_t I, std::size_t N >
+struct dual_loop
+{
+   template< typename T >
+   static void fill( T * r, T const & v )
+   {
+      r[I] = v;
+      dual_loop< I + 1, N >::fill( r, v );
+   }
+
+   template< typename T >
+   static void add( T * r, T const * x )
+   {
+      r[I] += x[I];
+      dual_loop< I + 1, N >::add( r, x );
+   }
+
+   template< typename T >
+   static void sub( T * r, T const * x )
+   {
+      r[I] -= x[I];
+      dual_loop< I + 1, N >::sub( r, x );
+   }
+
+   template< typename T >
+   static void scale( T * r, T const & a, T const * x )
+   {
+      r[I] = a * x[I];
+      dual_loop< I + 1, N >::scale( r, a, x );
+   }
+
+   template< typename T >
+   static void combine( T * r, T const & a, T const * x, T const & b, T const * y )
+   {
+      r[I] = a * x[I] + b * y[I];
+      dual_loop< I + 1, N >::combine( r, a, x, b, y );
+   }
+
+   template< typename T >
+   static bool all_zero( T const * x )
+   {
+      return x[I] == T( 0 ) && dual_loop< I + 1, N >::all_zero( x );
+   }
+};
+
+/**
+ * end of the element-wise operations.
+ */
+template< std::size_t N >
+struct dual_loop< N, N >
+{
+   template< typename T > static void fill( T *, T const & ) {}
+   template< typename T > static void add( T *, T const * ) {}
+   template< typename T > static void sub( T *, T const * ) {}
+   template< typename T > static void scale( T *, T const &, T const * ) {}
+   template< typename T > static void combine( T *, T const &, T const *, T const &, T const * ) {}
+   template< typename T > static bool all_zero( T const * ) { return true; }
+};
+
+} // namespace detail
+
+/**
+ * value with partial derivatives with respect to N variables; Seeds is void or their dimension_list.
+ */
+template< typename T = Rep, std::size_t N = 1, typename Seeds = void >
+class dual
+{
+public:
+   typedef T value_type;
+
+   enum { size = N };
+
+   /**
+    * zero.
+    */
+   dual()
+   : m_value( 0 )
+   {
+      fill( T( 0 ) );
+   }
+
+   /**
+    * constant: all derivatives zero.
+    */
+   dual( T const & value )
+   : m_value( value )
+   {
+      fill( T( 0 ) );
+   }
+
+   /**
+    * variable i: derivative one with respect to itself; i < N.
+    */
+   dual( T const & value, std::size_t const i )
+   : m_value( value )
+   {
+      fill( T( 0 ) );
+      m_d[i] = T( 1 );
+   }
+
+   T value() const
+   {
+      return m_value;
+   }
+
+   /**
+    * partial derivative with respect to variable i.
+    */
+   T d( std::size_t const i ) const
+   {
+      return m_d[i];
+   }
+
+   T & d( std::size_t const i )
+   {
+      return m_d[i];
+   }
+
+   dual & operator+=( dual const & rhs )
+   {
+      m_value += rhs.m_value;
+      detail::dual_loop< 0, N >::add( m_d, rhs.m_d );
+      return *this;
+   }
+
+   dual & operator-=( dual const & rhs )
+   {
+      m_value -= rhs.m_value;
+      detail::dual_loop< 0, N >::sub( m_d, rhs.m_d );
+      return *this;
+   }
+
+   dual & operator*=( dual const & rhs )
+   {
+      return *this = *this * rhs;
+   }
+
+   dual & operator/=( dual const & rhs )
+   {
+      return *this = *this / rhs;
+   }
+
+   friend dual operator+( dual const & x )
+   {
+      return x;
+   }
+
+   friend dual operator-( dual const & x )
+   {
+      return chain( -x.m_value, T( -1 ), x );
+   }
+
+   friend dual operator+( dual const & x, dual const & y )
+   {
+      dual z( x );
+      return z += y;
+   }
+
+   friend dual operator-( dual const & x, dual const & y )
+   {
+      dual z( x );
+      return z -= y;
+   }
+
+   friend dual operator*( dual const & x, dual const & y )
+   {
+      return chain( x.m_value * y.m_value, y.m_value, x, x.m_value, y );
+   }
+
+   friend dual operator/( dual const & x, dual const & y )
+   {
+      T const a = T( 1 ) / y.m_value;
+      T const z = x.m_value * a;
+
+      return chain( z, a, x, -z * a, y );
+   }
+
+   friend bool operator==( dual const & x, dual const & y ) { return x.m_value == y.m_value; }
+   friend bool operator!=( dual const & x, dual const & y ) { return x.m_value != y.m_value; }
+   friend bool operator< ( dual const & x, dual const & y ) { return x.m_value <  y.m_value; }
+   friend bool operator<=( dual const & x, dual const & y ) { return x.m_value <= y.m_value; }
+   friend bool operator> ( dual const & x, dual const & y ) { return x.m_value >  y.m_value; }
+   friend bool operator>=( dual const & x, dual const & y ) { return x.m_value >= y.m_value; }
+
+   friend dual fabs( dual const & x )
+   {
+      return x.m_value < T( 0 ) ? -x : x;
+   }
+
+   friend dual abs( dual const & x )
+   {
+      return fabs( x );
+   }
+
+   friend dual sqrt( dual const & x )
+   {
+      T const z = std::sqrt( x.m_value );
+
+      return chain( z, T( 0.5 ) / z, x );
+   }
+
+   friend dual exp( dual const & x )
+   {
+      T const z = std::exp( x.m_value );
+
+      return chain( z, z, x );
+   }
+
+   friend dual log( dual const & x )
+   {
+      return chain( std::log( x.m_value ), T( 1 ) / x.m_value, x );
+   }
+
+   /**
+    * x * y + z, with the value rounded once if the platform provides fma().
+    */
+   friend dual fma( dual const & x, dual const & y, dual const & z )
+   {
+      dual r = chain( detail::fma_( x.m_value, y.m_value, z.m_value ), y.m_value, x, x.m_value, y );
+      detail::dual_loop< 0, N >::add( r.m_d, z.m_d );
+      return r;
+   }
+
+   /**
+    * sqrt( x * x + y * y ) without undue overflow or underflow; the derivatives are taken as zero at zero.
+    */
+   friend dual hypot( dual const & x, dual const & y )
+   {
+      T const h = detail::hypot_( x.m_value, y.m_value );
+
+      return h == T( 0 ) ? dual( h ) : chain( h, x.m_value / h, x, y.m_value / h, y );
+   }
+
+   friend dual hypot( dual const & x, dual const & y, dual const & z )
+   {
+      return hypot( hypot( x, y ), z );
+   }
+
+   /**
+    * x to the power y; a constant exponent does not contribute.
+    */
+   friend dual pow( dual const & x, dual const & y )
+   {
+      T const z = std::pow( x.m_value, y.m_value );
+      T const a = y.m_value * std::pow( x.m_value, y.m_value - T( 1 ) );
+
+      return y.is_constant() ? chain( z, a, x ) : chain( z, a, x, std::log( x.m_value ) * z, y );
+   }
+
+   /**
+    * write as value [d0, d1, ...].
+    */
+   friend std::ostream & operator<<( std::ostream & os, dual const & x )
+   {
+      os << x.m_value << " [";
+      for ( std::size_t i = 0; i < N; ++i )
+      {
+         os << ( i ? ", " : "" ) << x.m_d[i];
+      }
+      return os << "]";
+   }
+
+private:
+   /**
+    * tag for a value whose derivatives are set next.
+    */
+   struct no_init {};
+
+   dual( T const & value, no_init )
+   : m_value( value )
+   {
+   }
+
+   void fill( T const & v )
+   {
+      detail::dual_loop< 0, N >::fill( m_d, v );
+   }
+
+   bool is_constant() const
+   {
+      return detail::dual_loop< 0, N >::all_zero( m_d );
+   }
+
+   /**
+    * value z with derivatives a * dx.
+    */
+   static dual chain( T const & z, T const & a, dual const & x )
+   {
+      dual r( z, no_init() );
+      detail::dual_loop< 0, N >::scale( r.m_d, a, x.m_d );
+      return r;
+   }
+
+   /**
+    * value z with derivatives a * dx + b * dy.
+    */
+   static dual chain( T const & z, T const & a, dual const & x, T const & b, dual const & y )
+   {
+      dual r( z, no_init() );
+      detail::dual_loop< 0, N >::combine( r.m_d, a, x.m_d, b, y.m_d );
+      return r;
+   }
+
+   T m_value;
+   T m_d[N];
+};
+
+/**
+ * seed variable i of N: quantity x with derivative one with respect to itself.
+ */
+template< std::size_t N, typename Dims, typename T >
+inline quantity< Dims, dual<T, N> >
+seed( quantity< Dims, T > const & x, std::size_t const i )
+{
+   return quantity< Dims, dual<T, N> >( detail::permit< dual<T, N> >( dual<T, N>( detail::value_of( x ), i ) ) );
+}
+
+/**
+ * value of a dual quantity.
+ */
+template< typename Dims, typename T, std::size_t N, typename Seeds >
+inline quantity< Dims, T >
+primal( quantity< Dims, dual<T, N, Seeds> > const & y )
+{
+   return quantity< Dims, T >( detail::permit<T>( y.get( detail::permit< dual<T, N, Seeds> >() ).value() ) );
+}
+
+/**
+ * value of a dimensionless dual result.
+ */
+template< typename T, std::size_t N, typename Seeds >
+inline T primal( dual<T, N, Seeds> const & y )
+{
+   return y.value();
+}
+
+/**
+ * partial derivative of y with respect to seed variable i, with dimensions XDims.
+ */
+template< typename XDims, typename Dims, typename T, std::size_t N >
+inline typename detail::quotient< Dims, XDims, T >::type
+derivative( quantity< Dims, dual<T, N> > const & y, std::size_t const i )
+{
+   return detail::from_value< typename detail::quotient< Dims, XDims, T >::dimension_type >(
+      y.get( detail::permit< dual<T, N> >() ).d( i ) );
+}
+
+/**
+ * partial derivative of a dimensionless y with respect to seed variable i, with dimensions XDims.
+ */
+template< typename XDims, typename T, std::size_t N >
+inline typename detail::reciprocal< XDims, T >::type
+derivative( dual<T, N> const & y, std::size_t const i )
+{
+   return detail::from_value< typename detail::reciprocal< XDims, T >::dimension_type >( y.d( i ) );
+}
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+/**
+ * seed variable I of the dimension_list Seeds: x must have the I-th dimensions of Seeds.
+ */
+template< typename Seeds, int I, typename Dims, typename T >
+inline quantity< Dims, dual<T, Seeds::size, Seeds> >
+seed( quantity< Dims, T > const & x )
+{
+   static_assert( detail::equal_dimensions< Dims, typename detail::list_at< I, Seeds >::type >::value,
+      "seed: dimensions differ from those of the seed variable" );
+
+   return quantity< Dims, dual<T, Seeds::size, Seeds> >(
+      detail::permit< dual<T, Seeds::size, Seeds> >( dual<T, Seeds::size, Seeds>( detail::value_of( x ), I ) ) );
+}
+
+/**
+ * partial derivative of y with respect to seed variable I, with the dimensions recorded in Seeds.
+ */
+template< int I, typename Dims, typename T, std::size_t N, typename Seeds >
+inline typename detail::quotient< Dims, typename detail::list_at< I, Seeds >::type, T >::type
+derivative( quantity< Dims, dual<T, N, Seeds> > const & y )
+{
+   return detail::from_value< typename detail::quotient< Dims, typename detail::list_at< I, Seeds >::type, T >::dimension_type >(
+      y.get( detail::permit< dual<T, N, Seeds> >() ).d( I ) );
+}
+
+/**
+ * partial derivative of a dimensionless y with respect to seed variable I, with the dimensions recorded in Seeds.
+ */
+template< int I, typename T, std::size_t N, typename Seeds >
+inline typename detail::reciprocal< typename detail::list_at< I, Seeds >::type, T >::type
+derivative( dual<T, N, Seeds> const & y )
+{
+   return detail::from_value< typename detail::reciprocal< typename detail::list_at< I, Seeds >::type, T >::dimension_type >( y.d( I ) );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/**
+ * dual * quantity.
+ */
+template< typename Dims, typename T, std::size_t N, typename Seeds >
+inline quantity< Dims, dual<T, N, Seeds> >
+operator*( dual<T, N, Seeds> const & lhs, quantity< Dims, T > const & rhs )
+{
+   return quantity< Dims, dual<T, N, Seeds> >( detail::permit< dual<T, N, Seeds> >( lhs * detail::value_of( rhs ) ) );
+}
+
+/**
+ * quantity * dual.
+ */
+template< typename Dims, typename T, std::size_t N, typename Seeds >
+inline quantity< Dims, dual<T, N, Seeds> >
+operator*( quantity< Dims, T > const & lhs, dual<T, N, Seeds> const & rhs )
+{
+   return quantity< Dims, dual<T, N, Seeds> >( detail::permit< dual<T, N, Seeds> >( detail::value_of( lhs ) * rhs ) );
+}
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_DUAL_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,525 @@
+/**
+ * \file quantity_interval.hpp
+ *
+ * \brief   Interval representation type for guaranteed bounds, for quantity< Dims, interval<> >.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * interval<T> holds a lower and an upper bound. Each operation returns an
+ * interval that contains every result for operands within their bounds,
+ * also for non-monotonic expressions:
+ *
+ *    quantity< electric_current_d, interval<> > i = interval<>( 1.9, 2.1 ) * ampere();
+ *    quantity< electric_resistance_d, interval<> > r = interval<>( 4.7, 5.3 ) * ohm();
+ *
+ *    quantity< power_d, interval<> > p = i * i * r;
+ *
+ *    if ( certainly( p < 25 * watt() ) ) ...      // within the envelope for all inputs
+ *
+ * Rounding: rather than switching the floating-point rounding mode, which
+ * is slow, serialises the pipeline and is ignored by optimizers without
+ * FENV_ACCESS, results are computed with the default round-to-nearest and
+ * then widened outward by at least one unit in the last place. The widening
+ * is branch-free, so that interval code keeps being vectorisable. std::pow
+ * is assumed accurate to one unit in the last place, and widened by two;
+ * hypot() is widened by four, which also covers its pre-C++11 fallback.
+ *
+ * Comparisons return a tribool: true or false if they hold or fail for all
+ * values in the intervals, indeterminate otherwise. Use certainly() or
+ * possibly() to obtain a bool. Equal-dimension quantity comparisons on
+ * interval quantities return a tribool as well.
+ *
+ * nth_power(), nth_root(), sqrt(), abs(), fma(), hypot() and io:: output of
+ * quantities work through the pow(), sqrt(), fabs(), fma(), hypot() and
+ * operator<< found for interval by argument-dependent lookup.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_INTERVAL_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_INTERVAL_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * result of an interval comparison: true, false or indeterminate.
+ */
+class tribool
+{
+public:
+   enum state { false_value, true_value, indeterminate_value };
+
+   tribool( bool const value )
+   : m_state( value ? true_value : false_value )
+   {
+   }
+
+   tribool( state const value )
+   : m_state( value )
+   {
+   }
+
+   state value() const
+   {
+      return m_state;
+   }
+
+   friend bool certainly( tribool const & x )
+   {
+      return x.m_state == true_value;
+   }
+
+   friend bool possibly( tribool const & x )
+   {
+      return x.m_state != false_value;
+   }
+
+   friend bool indeterminate( tribool const & x )
+   {
+      return x.m_state == indeterminate_value;
+   }
+
+   friend tribool operator!( tribool const & x )
+   {
+      return x.m_state == indeterminate_value ? x : tribool( x.m_state == false_value );
+   }
+
+private:
+   state m_state;
+};
+
+namespace detail {
+
+/**
+ * tribool from a condition that holds for all values and one that fails for all values.
+ */
+inline tribool make_tribool( bool const always, bool const never )
+{
+   return always ? tribool( true ) : never ? tribool( false ) : tribool( tribool::indeterminate_value );
+}
+
+/**
+ * value below x by at least ulps units in the last place; the smallest
+ * normal value covers results near zero, an overflow to infinity gives max;
+ * a NaN passes through unchanged.
+ */
+template< typename T >
+inline T widen_down( T const x, T const ulps = T( 1 ) )
+{
+   T const u = ulps * std::numeric_limits<T>::epsilon();
+   T const r = x - ( u * std::fabs( x ) + ( std::numeric_limits<T>::min )() );
+
+   return r < ( std::numeric_limits<T>::max )() || x != x ? r : ( std::numeric_limits<T>::max )();
+}
+
+/**
+ * value above x by at least ulps units in the last place; a NaN passes through unchanged.
+ */
+template< typename T >
+inline T widen_up( T const x, T const ulps = T( 1 ) )
+{
+   T const u = ulps * std::numeric_limits<T>::epsilon();
+   T const r = x + ( u * std::fabs( x ) + ( std::numeric_limits<T>::min )() );
+
+   return r > -( std::numeric_limits<T>::max )() || x != x ? r : -( std::numeric_limits<T>::max )();
+}
+
+/**
+ * x * y for a corner of an interval product; zero times infinity is zero,
+ * the limit for a bound approached from within, a NaN operand passes through.
+ */
+template< typename T >
+inline T corner_product( T const x, T const y )
+{
+   T const r = x * y;
+
+   return r == r || x != x || y != y ? r : T( 0 );
+}
+
+template< typename T >
+inline T min4( T const a, T const b, T const c, T const d )
+{
+   T const ab = a < b ? a : b;
+   T const cd = c < d ? c : d;
+   return ab < cd ? ab : cd;
+}
+
+template< typename T >
+inline T max4( T const a, T const b, T const c, T const d )
+{
+   T const ab = a < b ? b : a;
+   T const cd = c < d ? d : c;
+   return ab < cd ? cd : ab;
+}
+
+} // namespace detail
+
+/**
+ * closed interval [lower, upper] with outward rounding.
+ */
+template< typename T = Rep >
+class interval
+{
+public:
+   typedef T value_type;
+
+   interval()
+   : m_lo( 0 )
+   , m_hi( 0 )
+   {
+   }
+
+   /**
+    * the single value x.
+    */
+   interval( T const & x )
+   : m_lo( x )
+   , m_hi( x )
+   {
+   }
+
+   /**
+    * [lo, hi]; lo <= hi.
+    */
+   interval( T const & lo, T const & hi )
+   : m_lo( lo )
+   , m_hi( hi )
+   {
+   }
+
+   T lower() const
+   {
+      return m_lo;
+   }
+
+   T upper() const
+   {
+      return m_hi;
+   }
+
+   T mid() const
+   {
+      return m_lo + ( m_hi - m_lo ) / 2;
+   }
+
+   T width() const
+   {
+      return m_hi - m_lo;
+   }
+
+   bool contains( T const & x ) const
+   {
+      return m_lo <= x && x <= m_hi;
+   }
+
+   interval & operator+=( interval const & rhs )
+   {
+      return *this = *this + rhs;
+   }
+
+   interval & operator-=( interval const & rhs )
+   {
+      return *this = *this - rhs;
+   }
+
+   interval & operator*=( interval const & rhs )
+   {
+      return *this = *this * rhs;
+   }
+
+   interval & operator/=( interval const & rhs )
+   {
+      return *this = *this / rhs;
+   }
+
+   friend interval operator+( interval const & x )
+   {
+      return x;
+   }
+
+   friend interval operator-( interval const & x )
+   {
+      return interval( -x.m_hi, -x.m_lo );
+   }
+
+   friend interval operator+( interval const & x, interval const & y )
+   {
+      return interval( detail::widen_down( x.m_lo + y.m_lo ), detail::widen_up( x.m_hi + y.m_hi ) );
+   }
+
+   friend interval operator-( interval const & x, interval const & y )
+   {
+      return interval( detail::widen_down( x.m_lo - y.m_hi ), detail::widen_up( x.m_hi - y.m_lo ) );
+   }
+
+   friend interval operator*( interval const & x, interval const & y )
+   {
+      T const a = detail::corner_product( x.m_lo, y.m_lo );
+      T const b = detail::corner_product( x.m_lo, y.m_hi );
+      T const c = detail::corner_product( x.m_hi, y.m_lo );
+      T const d = detail::corner_product( x.m_hi, y.m_hi );
+
+      return interval( detail::widen_down( detail::min4( a, b, c, d ) ), detail::widen_up( detail::max4( a, b, c, d ) ) );
+   }
+
+   /**
+    * quotient; the whole real line if y contains zero. For y of either sign
+    * each bound takes one division, chosen by the signs without branches.
+    */
+   friend interval operator/( interval const & x, interval const & y )
+   {
+      bool const negative = y.m_hi < T( 0 );
+
+      T const lo = negative ? x.m_hi : x.m_lo;
+      T const hi = negative ? x.m_lo : x.m_hi;
+
+      T const q_lo = detail::widen_down( lo / ( lo < T( 0 ) ? y.m_lo : y.m_hi ) );
+      T const q_hi = detail::widen_up( hi / ( hi < T( 0 ) ? y.m_hi : y.m_lo ) );
+
+      bool const zero = y.contains( T( 0 ) );
+
+      return interval(
+         zero ? -std::numeric_limits<T>::infinity() : q_lo, zero ? std::numeric_limits<T>::infinity() : q_hi );
+   }
+
+   friend tribool operator< ( interval const & x, interval const & y ) { return detail::make_tribool( x.m_hi <  y.m_lo, x.m_lo >= y.m_hi ); }
+   friend tribool operator<=( interval const & x, interval const & y ) { return detail::make_tribool( x.m_hi <= y.m_lo, x.m_lo >  y.m_hi ); }
+   friend tribool operator> ( interval const & x, interval const & y ) { return y < x; }
+   friend tribool operator>=( interval const & x, interval const & y ) { return y <= x; }
+
+   friend tribool operator==( interval const & x, interval const & y )
+   {
+      return detail::make_tribool(
+         x.m_lo == x.m_hi && y.m_lo == y.m_hi && x.m_lo == y.m_lo, x.m_hi < y.m_lo || y.m_hi < x.m_lo );
+   }
+
+   friend tribool operator!=( interval const & x, interval const & y )
+   {
+      return !( x == y );
+   }
+
+   friend interval fabs( interval const & x )
+   {
+      return x.m_lo >= T( 0 ) ? x : x.m_hi <= T( 0 ) ? -x :
+         interval( T( 0 ), -x.m_lo < x.m_hi ? x.m_hi : -x.m_lo );
+   }
+
+   friend interval abs( interval const & x )
+   {
+      return fabs( x );
+   }
+
+   /**
+    * square, [0, ...] if x contains zero.
+    */
+   friend interval square( interval const & x )
+   {
+      interval const a = fabs( x );
+
+      return interval( a.m_lo == T( 0 ) ? T( 0 ) : detail::widen_down( a.m_lo * a.m_lo ), detail::widen_up( a.m_hi * a.m_hi ) );
+   }
+
+   /**
+    * square root of the non-negative part of x.
+    */
+   friend interval sqrt( interval const & x )
+   {
+      T const lo = x.m_lo < T( 0 ) ? T( 0 ) : x.m_lo;
+
+      return interval( lo == T( 0 ) ? T( 0 ) : detail::widen_down( std::sqrt( lo ) ), detail::widen_up( std::sqrt( x.m_hi ) ) );
+   }
+
+   /**
+    * x * y + z, enclosed; not rounded once, unlike std::fma.
+    */
+   friend interval fma( interval const & x, interval const & y, interval const & z )
+   {
+      return x * y + z;
+   }
+
+   /**
+    * sqrt( x * x + y * y ) without undue overflow or underflow; monotonic in fabs( x ) and fabs( y ).
+    */
+   friend interval hypot( interval const & x, interval const & y )
+   {
+      interval const a = fabs( x );
+      interval const b = fabs( y );
+
+      T const lo = detail::hypot_( a.m_lo, b.m_lo );
+
+      return interval( lo == T( 0 ) ? T( 0 ) : detail::widen_down( lo, T( 4 ) ), detail::widen_up( detail::hypot_( a.m_hi, b.m_hi ), T( 4 ) ) );
+   }
+
+   friend interval hypot( interval const & x, interval const & y, interval const & z )
+   {
+      return hypot( hypot( x, y ), z );
+   }
+
+   /**
+    * x to the power y; tight for integer y, by repeated squaring,
+    * otherwise for non-negative x from the powers of the end points.
+    */
+   friend interval pow( interval const & x, interval const & y )
+   {
+      if ( y.m_lo == y.m_hi && y.m_lo == std::floor( y.m_lo ) && std::fabs( y.m_lo ) < T( 1024 ) )
+      {
+         int const n = static_cast<int>( y.m_lo );
+
+         return n < 0 ? interval( T( 1 ) ) / integer_power( x, -n ) : integer_power( x, n );
+      }
+
+      T const lo = x.m_lo < T( 0 ) ? T( 0 ) : x.m_lo;
+
+      T const a = std::pow( lo, y.m_lo );
+      T const b = std::pow( lo, y.m_hi );
+      T const c = std::pow( x.m_hi, y.m_lo );
+      T const d = std::pow( x.m_hi, y.m_hi );
+
+      return interval(
+         detail::widen_down( detail::min4( a, b, c, d ), T( 2 ) ), detail::widen_up( detail::max4( a, b, c, d ), T( 2 ) ) );
+   }
+
+   /**
+    * write as [lower, upper].
+    */
+   friend std::ostream & operator<<( std::ostream & os, interval const & x )
+   {
+      return os << "[" << x.m_lo << ", " << x.m_hi << "]";
+   }
+
+private:
+   /**
+    * x to the power n >= 0; odd powers are monotonic, even powers are those of fabs( x ).
+    */
+   static interval integer_power( interval const & x, int const n )
+   {
+      if ( n == 0 )
+      {
+         return interval( T( 1 ) );
+      }
+
+      interval const a = n % 2 ? x : fabs( x );
+
+      return interval( a.m_lo == T( 0 ) ? T( 0 ) : point_power( a.m_lo, n ).m_lo, point_power( a.m_hi, n ).m_hi );
+   }
+
+   /**
+    * x to the power n >= 0 by repeated squaring.
+    */
+   static interval point_power( T const & x, int n )
+   {
+      interval result( T( 1 ) );
+      interval base( x );
+
+      for ( ; n > 0; n /= 2 )
+      {
+         if ( n % 2 )
+         {
+            result *= base;
+         }
+         if ( n > 1 )
+         {
+            base = square( base );
+         }
+      }
+      return result;
+   }
+
+   T m_lo;
+   T m_hi;
+};
+
+/**
+ * interval * quantity.
+ */
+template< typename Dims, typename T >
+inline quantity< Dims, interval<T> >
+operator*( interval<T> const & lhs, quantity< Dims, T > const & rhs )
+{
+   return quantity< Dims, interval<T> >( detail::permit< interval<T> >( lhs * detail::value_of( rhs ) ) );
+}
+
+/**
+ * quantity * interval.
+ */
+template< typename Dims, typename T >
+inline quantity< Dims, interval<T> >
+operator*( quantity< Dims, T > const & lhs, interval<T> const & rhs )
+{
+   return quantity< Dims, interval<T> >( detail::permit< interval<T> >( detail::value_of( lhs ) * rhs ) );
+}
+
+/**
+ * lower bound of an interval quantity.
+ */
+template< typename Dims, typename T >
+inline quantity< Dims, T >
+lower( quantity< Dims, interval<T> > const & q )
+{
+   return quantity< Dims, T >( detail::permit<T>( q.get( detail::permit< interval<T> >() ).lower() ) );
+}
+
+/**
+ * upper bound of an interval quantity.
+ */
+template< typename Dims, typename T >
+inline quantity< Dims, T >
+upper( quantity< Dims, interval<T> > const & q )
+{
+   return quantity< Dims, T >( detail::permit<T>( q.get( detail::permit< interval<T> >() ).upper() ) );
+}
+
+// Comparisons of interval quantities, tri-state
+
+template< typename Dims, typename X, typename Y >
+inline tribool operator==( quantity< Dims, interval<X> > const & lhs, quantity< Dims, interval<Y> > const & rhs )
+{
+   return lhs.get( detail::permit< interval<X> >() ) == rhs.get( detail::permit< interval<Y> >() );
+}
+
+template< typename Dims, typename X, typename Y >
+inline tribool operator!=( quantity< Dims, interval<X> > const & lhs, quantity< Dims, interval<Y> > const & rhs )
+{
+   return lhs.get( detail::permit< interval<X> >() ) != rhs.get( detail::permit< interval<Y> >() );
+}
+
+template< typename Dims, typename X, typename Y >
+inline tribool operator<( quantity< Dims, interval<X> > const & lhs, quantity< Dims, interval<Y> > const & rhs )
+{
+   return lhs.get( detail::permit< interval<X> >() ) < rhs.get( detail::permit< interval<Y> >() );
+}
+
+template< typename Dims, typename X, typename Y >
+inline tribool operator<=( quantity< Dims, interval<X> > const & lhs, quantity< Dims, interval<Y> > const & rhs )
+{
+   return lhs.get( detail::permit< interval<X> >() ) <= rhs.get( detail::permit< interval<Y> >() );
+}
+
+template< typename Dims, typename X, typename Y >
+inline tribool operator>( quantity< Dims, interval<X> > const & lhs, quantity< Dims, interval<Y> > const & rhs )
+{
+   return lhs.get( detail::permit< interval<X> >() ) > rhs.get( detail::permit< interval<Y> >() );
+}
+
+template< typename Dims, typename X, typename Y >
+inline tribool operator>=( quantity< Dims, interval<X> > const & lhs, quantity< Dims, interval<Y> > const & rhs )
+{
+   return lhs.get( detail::permit< interval<X> >() ) >= rhs.get( detail::permit< interval<Y> >() );
+}
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_INTERVAL_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -18,8 +18,9 @@
 #define PHYS_UNITS_QUANTITY_IO_HPP_INCLUDED
 
 #include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io_fwd.hpp"
 
-#include <iosfwd>
+#include <ostream>
 #include <stdexcept>
 #include <string>
 #include <sstream>
@@ -102,65 +103,67 @@ prefix( std::string const prefix_ )
  *
  * Made presentation customizable by specialization of template.
  * Adapted by Martin Moene, 21 February 2012.
+ * Declared in quantity_io_fwd.hpp.
+ */
+
+/**
+ * true if base dimension.
  */
 template < typename Dims >
-struct unit_info
+bool unit_info< Dims >::single()
 {
-   /**
-    * true if base dimension.
-    */
-   static bool single()
-   {
-      return Dims::is_base;
-   }
+   return Dims::is_base;
+}
 
-   /**
-    * provide unit's name.
-    */
-   static std::string name()
-   {
-      return symbol();
-   }
+/**
+ * provide unit's name.
+ */
+template < typename Dims >
+std::string unit_info< Dims >::name()
+{
+   return symbol();
+}
 
-   /**
-    * provide unit's symbol.
-    */
-   static std::string symbol()
-   {
-      std::ostringstream os;
+/**
+ * provide unit's symbol.
+ */
+template < typename Dims >
+std::string unit_info< Dims >::symbol()
+{
+   std::ostringstream os;
 
-      bool first = true;
+   bool first = true;
 
-      emit_dim( os, "m",   Dims::dim1, first );
-      emit_dim( os, "kg",  Dims::dim2, first );
-      emit_dim( os, "s",   Dims::dim3, first );
-      emit_dim( os, "A",   Dims::dim4, first );
-      emit_dim( os, "K",   Dims::dim5, first );
-      emit_dim( os, "mol", Dims::dim6, first );
-      emit_dim( os, "cd",  Dims::dim7, first );
+   emit_dim( os, "m",   Dims::dim1, first );
+   emit_dim( os, "kg",  Dims::dim2, first );
+   emit_dim( os, "s",   Dims::dim3, first );
+   emit_dim( os, "A",   Dims::dim4, first );
+   emit_dim( os, "K",   Dims::dim5, first );
+   emit_dim( os, "mol", Dims::dim6, first );
+   emit_dim( os, "cd",  Dims::dim7, first );
 
-      return os.str();
-   }
+   return os.str();
+}
 
-   static void emit_dim( std::ostream & os, const char * label, int exp, bool & first )
-   {
-      if( exp == 0 )
-         return;
+template < typename Dims >
+void unit_info< Dims >::emit_dim( std::ostream & os, const char * label, int exp, bool & first )
+{
+   if( exp == 0 )
+      return;
 
-      if ( first )
-         first = false;
-      else
-         os << " ";
+   if ( first )
+      first = false;
+   else
+      os << " ";
 
-      os << label;
+   os << label;
 
-      if( exp > 1 )
-         os << "+";
+   if( exp > 1 )
+      os << "+";
 
-      if( exp != 1 )
-         os << exp;
-   }
-};
+   if( exp != 1 )
+      os << exp;
+}
 
 template< typename  Dims, typename T >
 std::string to_magnitude( quantity< Dims, T > const & q )
@@ -201,7 +204,7 @@ std::string to_string( quantity< Dims, T > const & q )
 }
 
 template< typename Dims, typename T >
-inline std::ostream & operator<<( std::ostream & os, quantity< Dims, T > const & q )
+std::ostream & operator<<( std::ostream & os, quantity< Dims, T > const & q )
 {
    return os << q.get( detail::permit<T>() ) << " " << to_unit_symbol( q );
 }
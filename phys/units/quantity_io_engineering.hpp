@@ -42,7 +42,7 @@ namespace ct { namespace phys { namespace units {
  * format quantity in engineering units.
  * code derived from http://www.cs.tut.fi/~jkorpela/c/eng.html, by Jukka Korpela.
  */
-template < typename Dims, typename T = Rep >
+template < typename Dims, typename T >
 class eng_format
 {
 public:
@@ -213,7 +213,7 @@ private:
 };
 
 template< typename Dims, typename T >
-std::string to_eng_magnitude( quantity<Dims, T> const & q, int const digits = 6, bool const showpos = false )
+std::string to_eng_magnitude( quantity<Dims, T> const & q, int const digits, bool const showpos )
 {
    return eng_format<Dims, T>( q, digits, showpos ).magnitude();
 }
@@ -225,7 +225,7 @@ std::string to_eng_unit( quantity<Dims, T> const & q )
 }
 
 template< typename Dims, typename T >
-std::string to_eng_string( quantity<Dims, T> const & q, int const digits = 6, bool const showpos = false )
+std::string to_eng_string( quantity<Dims, T> const & q, int const digits, bool const showpos )
 {
    return eng_format<Dims, T>( q, digits, showpos ).repr();
 }
@@ -234,13 +234,13 @@ namespace io {
 namespace eng {
 
 template< typename Dims, typename T >
-std::string to_string( quantity<Dims, T> const & q, int const digits = 6, bool const showpos = false )
+std::string to_string( quantity<Dims, T> const & q, int const digits, bool const showpos )
 {
    return to_eng_string( q, digits, showpos );
 }
 
 template< typename Dims, typename T >
-inline std::ostream & operator<<( std::ostream & os, quantity< Dims, T > const & q )
+std::ostream & operator<<( std::ostream & os, quantity< Dims, T > const & q )
 {
    return os << to_string( q );
 }
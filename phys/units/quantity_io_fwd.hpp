@@ -0,0 +1,90 @@
+/**
+ * \file quantity_io_fwd.hpp
+ *
+ * \brief   IO declarations for quantity library.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Declares unit_info, the to_...() string conversions and the io:: and
+ * io::eng:: stream operators, with only <iosfwd> and <string>. A translation
+ * unit that includes just this header can write quantities; the definitions
+ * come from quantity_io.hpp and quantity_io_engineering.hpp, or from a
+ * library translation unit that instantiates them once for the common
+ * dimensions, see quantity_io_instantiate.hpp.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_IO_FWD_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_IO_FWD_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <iosfwd>
+#include <string>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * unit name and symbol; specialized per dimension in quantity_io_*.hpp,
+ * generic definitions in quantity_io.hpp.
+ */
+template < typename Dims >
+struct unit_info
+{
+   static bool single();
+   static std::string name();
+   static std::string symbol();
+   static void emit_dim( std::ostream & os, const char * label, int exp, bool & first );
+};
+
+template< typename Dims, typename T = Rep >
+class eng_format;
+
+template< typename Dims, typename T >
+std::string to_magnitude( quantity< Dims, T > const & q );
+
+template< typename Dims, typename T >
+std::string to_unit_name( quantity< Dims, T > const & q );
+
+template< typename Dims, typename T >
+std::string to_unit_symbol( quantity< Dims, T > const & q );
+
+template< typename Dims, typename T >
+std::string to_eng_magnitude( quantity<Dims, T> const & q, int const digits = 6, bool const showpos = false );
+
+template< typename Dims, typename T >
+std::string to_eng_unit( quantity<Dims, T> const & q );
+
+template< typename Dims, typename T >
+std::string to_eng_string( quantity<Dims, T> const & q, int const digits = 6, bool const showpos = false );
+
+namespace io {
+
+template< typename Dims, typename T >
+std::string to_string( quantity< Dims, T > const & q );
+
+template< typename Dims, typename T >
+std::ostream & operator<<( std::ostream & os, quantity< Dims, T > const & q );
+
+namespace eng {
+
+template< typename Dims, typename T >
+std::string to_string( quantity<Dims, T> const & q, int const digits = 6, bool const showpos = false );
+
+template< typename Dims, typename T >
+std::ostream & operator<<( std::ostream & os, quantity< Dims, T > const & q );
+
+} // namespace eng
+} // namespace io
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_IO_FWD_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,98 @@
+/**
+ * \file quantity_io_instantiate.hpp
+ *
+ * \brief   Explicit instantiation of quantity IO for common dimensions.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Translation units that only include quantity_io_fwd.hpp refer to the IO
+ * functions without instantiating them. Instantiate them once, in a library
+ * translation unit:
+ *
+ *    #include "phys/units/io.hpp"
+ *
+ *    PHYS_UNITS_IO_INSTANTIATE_COMMON( template )
+ *    PHYS_UNITS_IO_INSTANTIATE( template, heat_capacity_d )   // other dimensions
+ *
+ * Both macros are used at global scope, with quantity< Dims, Rep >. The unit
+ * symbols are those of the quantity_io_*.hpp headers that the library unit
+ * includes; as with any template, all units of a program must see the same
+ * unit_info specializations. Including quantity_io_symbols_fwd.hpp in the
+ * library unit turns a missing symbol header into a compile error.
+ *
+ * Translation units that include the full io.hpp instantiate the functions
+ * implicitly. With C++11, defining PHYS_UNITS_IO_EXTERN_TEMPLATES in those
+ * units, but not in the library unit, turns the common dimensions into
+ * extern template declarations, so that they are compiled only once.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_IO_INSTANTIATE_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_IO_INSTANTIATE_HPP_INCLUDED
+
+#include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_io_engineering.hpp"
+
+/**
+ * IO functions for quantity< Dims, Rep >; keyword is template or extern template.
+ */
+#define PHYS_UNITS_IO_INSTANTIATE( keyword, Dims ) \
+   namespace ct { namespace phys { namespace units { \
+   keyword std::string to_magnitude( quantity< Dims, Rep > const & ); \
+   keyword std::string to_unit_name( quantity< Dims, Rep > const & ); \
+   keyword std::string to_unit_symbol( quantity< Dims, Rep > const & ); \
+   keyword std::string to_eng_magnitude( quantity< Dims, Rep > const &, int const, bool const ); \
+   keyword std::string to_eng_unit( quantity< Dims, Rep > const & ); \
+   keyword std::string to_eng_string( quantity< Dims, Rep > const &, int const, bool const ); \
+   namespace io { \
+   keyword std::string to_string( quantity< Dims, Rep > const & ); \
+   keyword std::ostream & operator<<( std::ostream &, quantity< Dims, Rep > const & ); \
+   namespace eng { \
+   keyword std::string to_string( quantity< Dims, Rep > const &, int const, bool const ); \
+   keyword std::ostream & operator<<( std::ostream &, quantity< Dims, Rep > const & ); \
+   }}}}}
+
+/**
+ * IO functions for the base dimensions and the derived dimensions with named units.
+ */
+#define PHYS_UNITS_IO_INSTANTIATE_COMMON( keyword ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, length_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, mass_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, time_interval_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, electric_current_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, thermodynamic_temperature_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, amount_of_substance_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, luminous_intensity_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, area_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, volume_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, speed_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, acceleration_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, frequency_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, force_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, pressure_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, energy_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, power_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, electric_charge_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, electric_potential_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, capacitance_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, electric_resistance_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, electric_conductance_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, magnetic_flux_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, magnetic_flux_density_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, inductance_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, illuminance_d ) \
+   PHYS_UNITS_IO_INSTANTIATE( keyword, dose_equivalent_d )
+
+#if defined( PHYS_UNITS_IO_EXTERN_TEMPLATES ) && defined( PHYS_UNITS_CPP11_OR_GREATER )
+PHYS_UNITS_IO_INSTANTIATE_COMMON( extern template )
+#endif
+
+#endif // PHYS_UNITS_QUANTITY_IO_INSTANTIATE_HPP_INCLUDED
+
+/*
+ * end of file
+ */
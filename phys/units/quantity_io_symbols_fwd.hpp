@@ -0,0 +1,56 @@
+/**
+ * \file quantity_io_symbols_fwd.hpp
+ *
+ * \brief   declare the unit_info specializations of quantity_io_symbols.hpp.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Forward-only counterpart of quantity_io_symbols.hpp: declares, but does not
+ * define, the unit_info specializations of the named units, with only
+ * quantity_io_fwd.hpp. The quantity_io_*.hpp symbol headers themselves stay
+ * self-sufficient and include quantity_io.hpp.
+ *
+ * A translation unit that writes quantities via quantity_io_fwd.hpp can include
+ * this header to state that the program uses the named units. A unit that
+ * includes it and then instantiates the IO of one of these dimensions without
+ * the matching symbol header, for example through quantity_io_instantiate.hpp,
+ * fails to compile instead of silently using the generic spelling.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_IO_SYMBOLS_FWD_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_IO_SYMBOLS_FWD_HPP_INCLUDED
+
+#include "phys/units/quantity_io_fwd.hpp"
+
+namespace ct { namespace phys { namespace units {
+
+template<> struct unit_info< electric_charge_d >;          // coulomb
+template<> struct unit_info< dimensionless_d >;
+template<> struct unit_info< capacitance_d >;              // farad
+template<> struct unit_info< energy_d >;                   // joule
+template<> struct unit_info< inductance_d >;               // henry
+template<> struct unit_info< frequency_d >;                // hertz
+template<> struct unit_info< illuminance_d >;              // lux
+template<> struct unit_info< force_d >;                    // newton
+template<> struct unit_info< electric_resistance_d >;      // ohm
+template<> struct unit_info< pressure_d >;                 // pascal
+template<> struct unit_info< electric_conductance_d >;     // siemens
+template<> struct unit_info< dose_equivalent_d >;          // sievert
+template<> struct unit_info< speed_d >;
+template<> struct unit_info< magnetic_flux_density_d >;    // tesla
+template<> struct unit_info< electric_potential_d >;       // volt
+template<> struct unit_info< power_d >;                    // watt
+template<> struct unit_info< magnetic_flux_d >;            // weber
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_IO_SYMBOLS_FWD_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,135 @@
+/**
+ * \file quantity_literals.hpp
+ *
+ * \brief   constexpr user-defined literals for SI units with prefixes.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * The literals live in namespace literals and are opt-in:
+ *
+ *    using namespace phys::units::literals;
+ *
+ *    constexpr quantity< electric_resistance_d > r = 4.7_kOhm;
+ *    constexpr quantity< power_d >               p = 12_kW;
+ *    constexpr quantity< capacitance_d >         c = 3.3_uF;
+ *    constexpr quantity< acceleration_d >        g = 9.81_m_per_s2;
+ *
+ * There is a literal for every combination of an SI prefix (Y, Z, E, P, T,
+ * G, M, k, h, da, d, c, m, u for micro, n, p, f, a, z, y, or none) with the
+ * base units (m, g, s, A, K, mol, cd) and the derived units with a symbol in
+ * the quantity_io_*.hpp headers (Hz, N, Pa, J, W, C, V, F, Ohm, S, Wb, T, H,
+ * lm, lx, Bq, Gy, Sv). Radian and steradian are dimensionless and degree
+ * Celsius is not a multiple of kelvin; they have no literal. In addition
+ * there are m_per_s, km_per_h and m_per_s2.
+ *
+ * Each literal scales its value by a single long double factor and rounds
+ * once to Rep. Literals are constant expressions of the proper quantity
+ * type; where a constant is required, as for a constexpr variable, the
+ * compiler computes the value at any optimization level. Comparisons of
+ * quantities are constexpr as well.
+ *
+ * This header requires C++11 (user-defined literals, constexpr).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_LITERALS_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_LITERALS_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_literals.hpp requires C++11 or later
+#endif
+
+namespace ct { namespace phys { namespace units { namespace literals {
+
+/**
+ * floating-point and integer literal with the given suffix, for value * factor of dimensions Dims.
+ */
+#define PHYS_UNITS_LITERAL( suffix, Dims, factor ) \
+   constexpr quantity< Dims > operator "" ## suffix( long double const v ) \
+   { \
+      return quantity< Dims >( detail::permit<Rep>( static_cast<Rep>( v * ( factor ) ) ) ); \
+   } \
+   constexpr quantity< Dims > operator "" ## suffix( unsigned long long const v ) \
+   { \
+      return quantity< Dims >( detail::permit<Rep>( static_cast<Rep>( static_cast<long double>( v ) * ( factor ) ) ) ); \
+   }
+
+/**
+ * literals for all prefixes of a unit with symbol u, dimensions Dims and factor to coherent SI.
+ */
+#define PHYS_UNITS_PREFIXED_LITERALS( u, Dims, factor ) \
+   PHYS_UNITS_LITERAL( _Y  ## u, Dims, 1e+24L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _Z  ## u, Dims, 1e+21L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _E  ## u, Dims, 1e+18L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _P  ## u, Dims, 1e+15L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _T  ## u, Dims, 1e+12L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _G  ## u, Dims, 1e+9L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _M  ## u, Dims, 1e+6L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _k  ## u, Dims, 1e+3L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _h  ## u, Dims, 1e+2L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _da ## u, Dims, 1e+1L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _   ## u, Dims,          ( factor ) ) \
+   PHYS_UNITS_LITERAL( _d  ## u, Dims, 1e-1L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _c  ## u, Dims, 1e-2L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _m  ## u, Dims, 1e-3L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _u  ## u, Dims, 1e-6L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _n  ## u, Dims, 1e-9L  * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _p  ## u, Dims, 1e-12L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _f  ## u, Dims, 1e-15L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _a  ## u, Dims, 1e-18L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _z  ## u, Dims, 1e-21L * ( factor ) ) \
+   PHYS_UNITS_LITERAL( _y  ## u, Dims, 1e-24L * ( factor ) )
+
+// The seven SI base units; the prefixes of mass apply to the gram.
+
+PHYS_UNITS_PREFIXED_LITERALS( m,   length_d,                    1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( g,   mass_d,                      1e-3L )
+PHYS_UNITS_PREFIXED_LITERALS( s,   time_interval_d,             1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( A,   electric_current_d,          1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( K,   thermodynamic_temperature_d, 1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( mol, amount_of_substance_d,       1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( cd,  luminous_intensity_d,        1.0L )
+
+// The derived SI units with a symbol.
+
+PHYS_UNITS_PREFIXED_LITERALS( Hz,  frequency_d,                 1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( N,   force_d,                     1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( Pa,  pressure_d,                  1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( J,   energy_d,                    1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( W,   power_d,                     1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( C,   electric_charge_d,           1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( V,   electric_potential_d,        1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( F,   capacitance_d,               1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( Ohm, electric_resistance_d,       1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( S,   electric_conductance_d,      1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( Wb,  magnetic_flux_d,             1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( T,   magnetic_flux_density_d,     1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( H,   inductance_d,                1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( lm,  luminous_flux_d,             1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( lx,  illuminance_d,               1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( Bq,  activity_of_a_nuclide_d,     1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( Gy,  absorbed_dose_d,             1.0L )
+PHYS_UNITS_PREFIXED_LITERALS( Sv,  dose_equivalent_d,           1.0L )
+
+// Speed and acceleration.
+
+PHYS_UNITS_LITERAL( _m_per_s,  speed_d,        1.0L )
+PHYS_UNITS_LITERAL( _km_per_h, speed_d,        1e+3L / 3600 )
+PHYS_UNITS_LITERAL( _m_per_s2, acceleration_d, 1.0L )
+
+#undef PHYS_UNITS_PREFIXED_LITERALS
+#undef PHYS_UNITS_LITERAL
+
+}}}} // namespace ct { namespace phys { namespace units { namespace literals {
+
+#endif // PHYS_UNITS_QUANTITY_LITERALS_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,399 @@
+/**
+ * \file quantity_logger.hpp
+ *
+ * \brief   Low-latency logger of quantities that records raw values and formats them later.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * quantity_logger records a timestamp, a label, the dimension_code and the
+ * raw value of a quantity in a lock-free buffer of the logging thread, and
+ * formats nothing; drain() formats the records of all threads later, in
+ * time order, with to_unit_symbol() or eng_format:
+ *
+ *    quantity_logger log;
+ *
+ *    log.log( "supply", u );    // real-time thread: no formatting, locks or allocation
+ *    ...
+ *    log.drain( std::clog );    // other thread: "0.000120350 supply 229.8 V"
+ *
+ * start() drains periodically in a background thread until stop().
+ *
+ * The label must be a string that outlives the logger, typically a string
+ * literal; only its address is recorded. The value is recorded as double.
+ * A thread's buffer is allocated when it first logs; when it is full,
+ * records are dropped and counted by dropped(), so that log() never waits.
+ *
+ * Each thread's buffer has one writer, the thread, and one reader, drain(),
+ * so a record costs a clock read and a few plain stores. A thread finds its
+ * buffer of a logger in a thread_local table of 16 entries keyed by logger;
+ * it takes the logger's mutex, and may wait for drain() to collect the
+ * records, only when it first logs to the logger, or when another logger has
+ * taken the entry since.
+ *
+ * This header requires C++11 (std::atomic, std::thread, thread_local).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_LOGGER_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_LOGGER_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_io_engineering.hpp"
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_logger.hpp requires C++11 or later
+#endif
+
+#include <algorithm>    // for stable_sort
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint64_t
+#include <cstdio>       // for snprintf
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * record of a logged quantity.
+ */
+struct log_record
+{
+   std::int64_t time;      // ns since the logger started
+   char const * label;
+   long long code;         // dimension_code of the quantity
+   void (*format)( std::ostream &, double, bool );
+   double value;
+};
+
+namespace detail {
+
+/**
+ * write value v of a quantity< Dims, T > with its unit, in engineering format if eng.
+ */
+template< typename Dims, typename T >
+void log_format( std::ostream & os, double const v, bool const eng )
+{
+   quantity< Dims, T > const q( permit< T >( static_cast< T >( v ) ) );
+
+   if ( eng )
+   {
+      os << eng_format< Dims, T >( q ).repr();
+   }
+   else
+   {
+      os << v << " " << to_unit_symbol( q );
+   }
+}
+
+/**
+ * single-writer, single-reader buffer of log records.
+ */
+class log_buffer
+{
+public:
+   explicit log_buffer( std::size_t const capacity )
+   : m_owner( std::this_thread::get_id() )
+   , m_records( capacity )
+   , m_mask( capacity - 1 )
+   , m_head( 0 )
+   , m_tail_cache( 0 )
+   , m_dropped( 0 )
+   , m_tail( 0 )
+   {
+   }
+
+   /**
+    * append r; false if the buffer is full. Writer only.
+    */
+   bool push( log_record const & r )
+   {
+      std::size_t const head = m_head.load( std::memory_order_relaxed );
+
+      if ( head - m_tail_cache > m_mask )
+      {
+         m_tail_cache = m_tail.load( std::memory_order_acquire );
+
+         if ( head - m_tail_cache > m_mask )
+         {
+            m_dropped.store( m_dropped.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+            return false;
+         }
+      }
+      m_records[ head & m_mask ] = r;
+      m_head.store( head + 1, std::memory_order_release );
+      return true;
+   }
+
+   /**
+    * move the buffered records to out. Reader only.
+    */
+   void take( std::vector< log_record > & out )
+   {
+      std::size_t const tail = m_tail.load( std::memory_order_relaxed );
+      std::size_t const head = m_head.load( std::memory_order_acquire );
+
+      for ( std::size_t i = tail; i != head; ++i )
+      {
+         out.push_back( m_records[ i & m_mask ] );
+      }
+      m_tail.store( head, std::memory_order_release );
+   }
+
+   std::size_t dropped() const
+   {
+      return m_dropped.load( std::memory_order_relaxed );
+   }
+
+   /**
+    * the writing thread.
+    */
+   std::thread::id owner() const
+   {
+      return m_owner;
+   }
+
+private:
+   // writer's cache line, then the reader's
+
+   std::thread::id m_owner;
+   std::vector< log_record > m_records;
+   std::size_t m_mask;
+   std::atomic< std::size_t > m_head;
+   std::size_t m_tail_cache;
+   std::atomic< std::size_t > m_dropped;
+   char pad[ 64 ];
+   std::atomic< std::size_t > m_tail;
+};
+
+} // namespace detail
+
+/**
+ * logger of quantities with a buffer per logging thread.
+ */
+class quantity_logger
+{
+public:
+   enum { default_capacity = 1 << 16 };
+
+   /**
+    * logger with buffers of capacity records (a power of two) per thread, formatting in engineering units if eng.
+    */
+   explicit quantity_logger( std::size_t const capacity = default_capacity, bool const eng = false )
+   : m_capacity( capacity )
+   , m_eng( eng )
+   , m_id( next_id() )
+   , m_start( std::chrono::steady_clock::now() )
+   , m_mutex()
+   , m_buffers()
+   , m_thread()
+   , m_stop( false )
+   , m_wake_mutex()
+   , m_wake()
+   {
+      if ( capacity == 0 || ( capacity & ( capacity - 1 ) ) != 0 )
+      {
+         throw quantity_error( "quantity: logger: capacity must be a power of two" );
+      }
+   }
+
+   ~quantity_logger()
+   {
+      stop();
+   }
+
+   quantity_logger( quantity_logger const & ) = delete;
+   quantity_logger & operator=( quantity_logger const & ) = delete;
+
+   /**
+    * record q with label; false if the thread's buffer is full and the record is dropped.
+    */
+   template< typename Dims, typename T >
+   bool log( char const * const label, quantity< Dims, T > const & q )
+   {
+      log_record r;
+      r.time = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - m_start ).count();
+      r.label = label;
+      r.code = dimension_code< Dims >::value;
+      r.format = &detail::log_format< Dims, T >;
+      r.value = static_cast< double >( detail::value_of( q ) );
+
+      return buffer().push( r );
+   }
+
+   /**
+    * format the records logged so far, in time order, one per line; returns their number.
+    */
+   std::size_t drain( std::ostream & os )
+   {
+      std::vector< log_record > records;
+      {
+         std::lock_guard< std::mutex > lock( m_mutex );
+
+         for ( std::size_t i = 0; i < m_buffers.size(); ++i )
+         {
+            m_buffers[i]->take( records );
+         }
+      }
+
+      std::stable_sort( records.begin(), records.end(), earlier );
+
+      for ( std::size_t i = 0; i < records.size(); ++i )
+      {
+         format( os, records[i] );
+      }
+      return records.size();
+   }
+
+   /**
+    * write record r as "seconds label value unit".
+    */
+   void format( std::ostream & os, log_record const & r ) const
+   {
+      char time[32];
+      std::snprintf( time, sizeof time, "%.9f", r.time * 1e-9 );
+
+      os << time << " " << r.label << " ";
+      r.format( os, r.value, m_eng );
+      os << "\n";
+   }
+
+   /**
+    * number of records dropped because a thread's buffer was full.
+    */
+   std::size_t dropped() const
+   {
+      std::lock_guard< std::mutex > lock( m_mutex );
+
+      std::size_t n = 0;
+      for ( std::size_t i = 0; i < m_buffers.size(); ++i )
+      {
+         n += m_buffers[i]->dropped();
+      }
+      return n;
+   }
+
+   /**
+    * drain to os every period in a background thread, until stop(); os must outlive it.
+    */
+   void start( std::ostream & os, std::chrono::milliseconds const period = std::chrono::milliseconds( 100 ) )
+   {
+      stop();
+
+      m_stop = false;
+      m_thread = std::thread( [this, &os, period]
+      {
+         std::unique_lock< std::mutex > lock( m_wake_mutex );
+
+         for ( ;; )
+         {
+            bool const stopping = m_wake.wait_for( lock, period, [this] { return m_stop; } );
+
+            lock.unlock();
+            drain( os );
+            lock.lock();
+
+            if ( stopping )
+            {
+               break;
+            }
+         }
+      } );
+   }
+
+   /**
+    * stop the background thread after a last drain.
+    */
+   void stop()
+   {
+      if ( m_thread.joinable() )
+      {
+         {
+            std::lock_guard< std::mutex > lock( m_wake_mutex );
+            m_stop = true;
+         }
+         m_wake.notify_one();
+         m_thread.join();
+      }
+   }
+
+private:
+   static bool earlier( log_record const & a, log_record const & b )
+   {
+      return a.time < b.time;
+   }
+
+   static std::uint64_t next_id()
+   {
+      static std::atomic< std::uint64_t > id( 0 );
+
+      return ++id;
+   }
+
+   /**
+    * this thread's buffer, allocated when the thread first logs; found via a thread_local table keyed by logger.
+    */
+   detail::log_buffer & buffer()
+   {
+      struct cache
+      {
+         std::uint64_t id;
+         detail::log_buffer * buffer;
+      };
+
+      enum { caches = 16 };
+
+      static thread_local cache table[ caches ] = {};
+
+      cache & c = table[ m_id % caches ];
+
+      if ( c.id != m_id )
+      {
+         std::lock_guard< std::mutex > lock( m_mutex );
+
+         std::size_t i = 0;
+         while ( i < m_buffers.size() && m_buffers[i]->owner() != std::this_thread::get_id() )
+         {
+            ++i;
+         }
+         if ( i == m_buffers.size() )
+         {
+            m_buffers.push_back( std::unique_ptr< detail::log_buffer >( new detail::log_buffer( m_capacity ) ) );
+         }
+         c.id = m_id;
+         c.buffer = m_buffers[i].get();
+      }
+      return *c.buffer;
+   }
+
+   std::size_t m_capacity;
+   bool m_eng;
+   std::uint64_t m_id;
+   std::chrono::steady_clock::time_point m_start;
+
+   mutable std::mutex m_mutex;
+   std::vector< std::unique_ptr< detail::log_buffer > > m_buffers;
+
+   std::thread m_thread;
+   bool m_stop;
+   std::mutex m_wake_mutex;
+   std::condition_variable m_wake;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_LOGGER_HPP_INCLUDED
+
+/*
+ * end of file
+ */
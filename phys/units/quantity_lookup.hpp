@@ -0,0 +1,258 @@
+/**
+ * \file quantity_lookup.hpp
+ *
+ * \brief   Piecewise-linear interpolation tables keyed and valued by quantities.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * lookup_table<XDims, YDims> maps a quantity with dimensions XDims to an
+ * interpolated quantity with dimensions YDims, e.g. resistance versus
+ * temperature:
+ *
+ *    lookup_table< thermodynamic_temperature_d, electric_resistance_d > r( t, rt, n );
+ *    quantity< electric_resistance_d > r300 = r( 300 * kelvin() );
+ *
+ * Tables on a uniform grid find the segment in O(1), other tables use a
+ * branchless binary search over a contiguous key array. Each segment stores
+ * its key, value and precomputed slope next to each other, so that an
+ * evaluation touches one cache line beyond the search. Keys outside the
+ * table extrapolate linearly from the first or last segment.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_LOOKUP_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_LOOKUP_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#include <algorithm>
+#include <cstddef>  // for size_t
+#include <vector>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * piecewise-linear lookup table.
+ */
+template< typename XDims, typename YDims, typename T = Rep >
+class lookup_table
+{
+public:
+   typedef TYPENAME_TYPE_K detail::collapse< XDims, T >::type key_type;
+   typedef TYPENAME_TYPE_K detail::collapse< YDims, T >::type value_type;
+   typedef TYPENAME_TYPE_K detail::quotient< YDims, XDims, T >::type slope_type;
+
+   /**
+    * table with n strictly increasing keys x and values y; n >= 2.
+    */
+   lookup_table( key_type const * x, value_type const * y, std::size_t const n )
+   : m_keys( n )
+   , m_segments()
+   , m_x0( 0 )
+   , m_inv_dx( 0 )
+   , m_uniform( false )
+   {
+      require( n >= 2, "quantity: lookup_table: need at least two entries" );
+
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         m_keys[i] = detail::value_of( x[i] );
+      }
+
+      for ( std::size_t i = 1; i < n; ++i )
+      {
+         require( m_keys[i - 1] < m_keys[i], "quantity: lookup_table: keys must be strictly increasing" );
+      }
+
+      m_x0 = m_keys[0];
+      init_segments( y );
+   }
+
+   /**
+    * table with n values y on the uniform grid x0 + i * dx; n >= 2, dx > 0.
+    */
+   lookup_table( key_type const & x0, key_type const & dx, value_type const * y, std::size_t const n )
+   : m_keys( n )
+   , m_segments()
+   , m_x0( detail::value_of( x0 ) )
+   , m_inv_dx( 0 )
+   , m_uniform( true )
+   {
+      require( n >= 2, "quantity: lookup_table: need at least two entries" );
+      require( detail::value_of( dx ) > T( 0 ), "quantity: lookup_table: spacing must be positive" );
+
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         m_keys[i] = m_x0 + T( i ) * detail::value_of( dx );
+      }
+
+      m_inv_dx = T( 1 ) / detail::value_of( dx );
+      init_segments( y );
+   }
+
+   /**
+    * number of entries.
+    */
+   std::size_t size() const
+   {
+      return m_keys.size();
+   }
+
+   /**
+    * true if the keys are on a uniform grid.
+    */
+   bool uniform() const
+   {
+      return m_uniform;
+   }
+
+   /**
+    * key of entry i.
+    */
+   key_type key( std::size_t const i ) const
+   {
+      return detail::from_value< XDims, T >( m_keys[i] );
+   }
+
+   /**
+    * value of entry i.
+    */
+   value_type value( std::size_t const i ) const
+   {
+      return detail::from_value< YDims, T >( i + 1 < size() ? m_segments[3 * i + 1] : last_value() );
+   }
+
+   /**
+    * slope of segment i, between entries i and i + 1.
+    */
+   slope_type slope( std::size_t const i ) const
+   {
+      return detail::from_value< TYPENAME_TYPE_K detail::quotient< YDims, XDims, T >::dimension_type, T >( m_segments[3 * i + 2] );
+   }
+
+   /**
+    * index of the segment that contains x, in [0, size() - 1).
+    */
+   std::size_t segment( key_type const & x ) const
+   {
+      return m_uniform ? uniform_segment( detail::value_of( x ) ) : search_segment( detail::value_of( x ) );
+   }
+
+   /**
+    * interpolated value at x.
+    */
+   value_type operator()( key_type const & x ) const
+   {
+      T const v = detail::value_of( x );
+
+      return detail::from_value< YDims, T >( m_uniform ? eval( uniform_segment( v ), v ) : eval( search_segment( v ), v ) );
+   }
+
+   /**
+    * interpolated values at x[0..n) into out[0..n).
+    */
+   void operator()( key_type const * x, std::size_t const n, value_type * out ) const
+   {
+      if ( m_uniform )
+      {
+         for ( std::size_t i = 0; i < n; ++i )
+         {
+            T const v = detail::value_of( x[i] );
+            out[i] = detail::from_value< YDims, T >( eval( uniform_segment( v ), v ) );
+         }
+      }
+      else
+      {
+         for ( std::size_t i = 0; i < n; ++i )
+         {
+            T const v = detail::value_of( x[i] );
+            out[i] = detail::from_value< YDims, T >( eval( search_segment( v ), v ) );
+         }
+      }
+   }
+
+private:
+   static void require( bool const condition, char const * const text )
+   {
+      if ( !condition )
+      {
+         throw quantity_error( text );
+      }
+   }
+
+   void init_segments( value_type const * y )
+   {
+      std::size_t const n = m_keys.size();
+
+      m_segments.resize( 3 * ( n - 1 ) + 1 );
+
+      for ( std::size_t i = 0; i + 1 < n; ++i )
+      {
+         T const y0 = detail::value_of( y[i    ] );
+         T const y1 = detail::value_of( y[i + 1] );
+
+         m_segments[3 * i    ] = m_keys[i];
+         m_segments[3 * i + 1] = y0;
+         m_segments[3 * i + 2] = ( y1 - y0 ) / ( m_keys[i + 1] - m_keys[i] );
+      }
+
+      // value of the last entry, after the last segment
+
+      m_segments[3 * ( n - 1 )] = detail::value_of( y[n - 1] );
+   }
+
+   T last_value() const
+   {
+      return m_segments.back();
+   }
+
+   T eval( std::size_t const i, T const x ) const
+   {
+      T const * const s = &m_segments[3 * i];
+
+      return s[1] + s[2] * ( x - s[0] );
+   }
+
+   std::size_t uniform_segment( T const x ) const
+   {
+      T const f = ( x - m_x0 ) * m_inv_dx;
+
+      return std::size_t( (std::max)( T( 0 ), (std::min)( f, T( m_keys.size() - 2 ) ) ) );
+   }
+
+   std::size_t search_segment( T const x ) const
+   {
+      // last key <= x among the first size() - 1 keys; conditional moves only
+
+      T const * base = &m_keys[0];
+      std::size_t len = m_keys.size() - 1;
+
+      while ( len > 1 )
+      {
+         std::size_t const half = len / 2;
+         base += ( base[half] <= x ) ? half : 0;
+         len  -= half;
+      }
+      return std::size_t( base - &m_keys[0] );
+   }
+
+private:
+   std::vector< T > m_keys;
+   std::vector< T > m_segments;   // key, value, slope per segment, then the last value
+   T m_x0;
+   T m_inv_dx;
+   bool m_uniform;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_LOOKUP_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,432 @@
+/**
+ * \file quantity_matrix.hpp
+ *
+ * \brief   Small fixed-size matrices with per-row and per-column dimensions.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * quantity_matrix< RowDims, ColDims, T > models matrices such as the state
+ * transition and covariance matrices of a Kalman filter, where each state
+ * has its own unit. RowDims and ColDims are dimension_list<>s; element (i,j)
+ * has the dimensions RowDims[i] * ColDims[j]. E.g. for the state
+ * x = [ position, velocity ]:
+ *
+ * - the covariance P has RowDims = ColDims = dimension_list< length_d, speed_d >,
+ * - the transition F has RowDims = dimension_list< length_d, speed_d > and
+ *   ColDims = dimension_list< reciprocal length, reciprocal speed >.
+ *
+ * A product A * B is accepted if ColDims(A)[k] * RowDims(B)[k] is the same
+ * for all k; otherwise it does not compile. A column vector is a matrix with
+ * ColDims = dimension_list< dimensionless_d >.
+ *
+ * Storage is a plain T[rows][cols] and all loops have compile-time bounds,
+ * so that the generated code is that of the equivalent raw-double code.
+ *
+ * This header requires C++11 (variadic templates).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_MATRIX_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_MATRIX_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_matrix.hpp requires C++11 or later
+#endif
+
+#include <cmath>    // for sqrt()
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * dimension_list with each entry multiplied by Dims.
+ */
+template< typename List, typename Dims >
+struct list_product;
+
+template< typename... Ds, typename Dims >
+struct list_product< dimension_list< Ds... >, Dims >
+{
+   typedef dimension_list< typename product< Ds, Dims, Rep >::dimension_type... > type;
+};
+
+/**
+ * dimension_list with each entry inverted.
+ */
+template< typename List >
+struct list_reciprocal;
+
+template< typename... Ds >
+struct list_reciprocal< dimension_list< Ds... > >
+{
+   typedef dimension_list< typename reciprocal< Ds, Rep >::dimension_type... > type;
+};
+
+/**
+ * dimension_list of N times Dims.
+ */
+template< int N, typename Dims, typename... Ds >
+struct list_repeat
+{
+   typedef typename list_repeat< N - 1, Dims, Dims, Ds... >::type type;
+};
+
+template< typename Dims, typename... Ds >
+struct list_repeat< 0, Dims, Ds... >
+{
+   typedef dimension_list< Ds... > type;
+};
+
+/**
+ * true if all dimensions equal the first.
+ */
+template< typename First, typename... Rest >
+struct all_equal_dimensions;
+
+template< typename First >
+struct all_equal_dimensions< First >
+{
+   enum { value = true };
+};
+
+template< typename First, typename Second, typename... Rest >
+struct all_equal_dimensions< First, Second, Rest... >
+{
+   enum
+   {
+      value = equal_dimensions< First, Second >::value &&
+              all_equal_dimensions< First, Rest... >::value
+   };
+};
+
+/**
+ * pairwise products of two dimension_lists; uniform if all products are equal.
+ */
+template< typename Lhs, typename Rhs >
+struct list_inner;
+
+template< typename L0, typename... Ls, typename R0, typename... Rs >
+struct list_inner< dimension_list< L0, Ls... >, dimension_list< R0, Rs... > >
+{
+   typedef typename product< L0, R0, Rep >::dimension_type dimension_type;
+
+   enum
+   {
+      uniform = all_equal_dimensions< dimension_type, typename product< Ls, Rs, Rep >::dimension_type... >::value
+   };
+};
+
+} // namespace detail
+
+/**
+ * matrix of quantities with dimensions RowDims[i] * ColDims[j] for element (i,j).
+ */
+template< typename RowDims, typename ColDims, typename T = Rep >
+class quantity_matrix
+{
+public:
+   typedef RowDims row_dimensions;
+
+   typedef ColDims column_dimensions;
+
+   typedef T value_type;
+
+   typedef quantity_matrix< RowDims, ColDims, T > this_type;
+
+   enum { rows = RowDims::size, cols = ColDims::size };
+
+   /**
+    * type of element (i,j).
+    */
+   template< int I, int J >
+   struct element
+   {
+      typedef detail::product<
+         typename detail::list_at< I, RowDims >::type,
+         typename detail::list_at< J, ColDims >::type, T > generator;
+
+      typedef typename generator::dimension_type dimension_type;
+
+      typedef typename generator::type type;
+   };
+
+   /**
+    * uninitialized matrix, like quantity.
+    */
+   quantity_matrix()
+   {
+   }
+
+   /**
+    * the null matrix.
+    */
+   static quantity_matrix zero()
+   {
+      quantity_matrix result;
+
+      for ( int i = 0; i < rows; ++i )
+         for ( int j = 0; j < cols; ++j )
+            result.m_value[i][j] = value_type( 0 );
+
+      return result;
+   }
+
+   /**
+    * the identity matrix; the diagonal must be dimensionless.
+    */
+   static quantity_matrix identity()
+   {
+      typedef detail::list_inner< RowDims, ColDims > diagonal;
+
+      static_assert( rows == cols, "identity matrix must be square" );
+      static_assert( diagonal::uniform && diagonal::dimension_type::is_all_zero,
+         "identity matrix diagonal must be dimensionless" );
+
+      quantity_matrix result = zero();
+
+      for ( int i = 0; i < rows; ++i )
+         result.m_value[i][i] = value_type( 1 );
+
+      return result;
+   }
+
+   /**
+    * element (I,J).
+    */
+   template< int I, int J >
+   typename element< I, J >::type get() const
+   {
+      return detail::from_value< typename element< I, J >::dimension_type, T >( m_value[I][J] );
+   }
+
+   /**
+    * set element (I,J).
+    */
+   template< int I, int J >
+   void set( typename element< I, J >::type const & q )
+   {
+      m_value[I][J] = detail::value_of( q );
+   }
+
+   this_type & operator+=( this_type const & rhs )
+   {
+      for ( int i = 0; i < rows; ++i )
+         for ( int j = 0; j < cols; ++j )
+            m_value[i][j] += rhs.m_value[i][j];
+
+      return *this;
+   }
+
+   this_type & operator-=( this_type const & rhs )
+   {
+      for ( int i = 0; i < rows; ++i )
+         for ( int j = 0; j < cols; ++j )
+            m_value[i][j] -= rhs.m_value[i][j];
+
+      return *this;
+   }
+
+   this_type & operator*=( Rep const & rhs )
+   {
+      for ( int i = 0; i < rows; ++i )
+         for ( int j = 0; j < cols; ++j )
+            m_value[i][j] *= rhs;
+
+      return *this;
+   }
+
+   /**
+    * permit access to value (i,j) (non-const).
+    */
+   value_type & value( int const i, int const j, detail::permit< value_type > const & )
+   {
+      return m_value[i][j];
+   }
+
+   /**
+    * permit access to value (i,j) (const).
+    */
+   value_type const & value( int const i, int const j, detail::permit< value_type > const & ) const
+   {
+      return m_value[i][j];
+   }
+
+private:
+   value_type m_value[rows][cols];
+};
+
+/**
+ * mat + mat
+ */
+template< typename RowDims, typename ColDims, typename T >
+inline quantity_matrix< RowDims, ColDims, T >
+operator+( quantity_matrix< RowDims, ColDims, T > const & lhs, quantity_matrix< RowDims, ColDims, T > const & rhs )
+{
+   quantity_matrix< RowDims, ColDims, T > result( lhs );
+   return result += rhs;
+}
+
+/**
+ * mat - mat
+ */
+template< typename RowDims, typename ColDims, typename T >
+inline quantity_matrix< RowDims, ColDims, T >
+operator-( quantity_matrix< RowDims, ColDims, T > const & lhs, quantity_matrix< RowDims, ColDims, T > const & rhs )
+{
+   quantity_matrix< RowDims, ColDims, T > result( lhs );
+   return result -= rhs;
+}
+
+/**
+ * - mat
+ */
+template< typename RowDims, typename ColDims, typename T >
+inline quantity_matrix< RowDims, ColDims, T >
+operator-( quantity_matrix< RowDims, ColDims, T > const & rhs )
+{
+   quantity_matrix< RowDims, ColDims, T > result( rhs );
+   return result *= Rep( -1 );
+}
+
+/**
+ * mat * num
+ */
+template< typename RowDims, typename ColDims, typename T >
+inline quantity_matrix< RowDims, ColDims, T >
+operator*( quantity_matrix< RowDims, ColDims, T > const & lhs, Rep const & rhs )
+{
+   quantity_matrix< RowDims, ColDims, T > result( lhs );
+   return result *= rhs;
+}
+
+/**
+ * num * mat
+ */
+template< typename RowDims, typename ColDims, typename T >
+inline quantity_matrix< RowDims, ColDims, T >
+operator*( Rep const & lhs, quantity_matrix< RowDims, ColDims, T > const & rhs )
+{
+   quantity_matrix< RowDims, ColDims, T > result( rhs );
+   return result *= lhs;
+}
+
+/**
+ * mat * mat; the inner dimensions ColDims(lhs)[k] * RowDims(rhs)[k] must be the same for all k.
+ */
+template< typename LhsRowDims, typename LhsColDims, typename RhsRowDims, typename RhsColDims, typename T >
+inline quantity_matrix<
+   typename detail::list_product< LhsRowDims, typename detail::list_inner< LhsColDims, RhsRowDims >::dimension_type >::type,
+   RhsColDims, T >
+operator*( quantity_matrix< LhsRowDims, LhsColDims, T > const & lhs, quantity_matrix< RhsRowDims, RhsColDims, T > const & rhs )
+{
+   typedef detail::list_inner< LhsColDims, RhsRowDims > inner;
+
+   static_assert( inner::uniform, "matrix product inner dimensions must be uniform" );
+
+   typedef quantity_matrix< typename detail::list_product< LhsRowDims, typename inner::dimension_type >::type, RhsColDims, T > result_type;
+
+   enum { M = LhsRowDims::size, N = LhsColDims::size, P = RhsColDims::size };
+
+   detail::permit<T> const p;
+
+   result_type result;
+
+   for ( int i = 0; i < M; ++i )
+   {
+      for ( int j = 0; j < P; ++j )
+      {
+         T sum( 0 );
+
+         for ( int k = 0; k < N; ++k )
+         {
+            sum += lhs.value( i, k, p ) * rhs.value( k, j, p );
+         }
+         result.value( i, j, p ) = sum;
+      }
+   }
+   return result;
+}
+
+/**
+ * transpose; element (i,j) of the result is element (j,i) of the argument.
+ */
+template< typename RowDims, typename ColDims, typename T >
+inline quantity_matrix< ColDims, RowDims, T >
+transpose( quantity_matrix< RowDims, ColDims, T > const & m )
+{
+   enum { M = RowDims::size, N = ColDims::size };
+
+   detail::permit<T> const p;
+
+   quantity_matrix< ColDims, RowDims, T > result;
+
+   for ( int i = 0; i < M; ++i )
+      for ( int j = 0; j < N; ++j )
+         result.value( j, i, p ) = m.value( i, j, p );
+
+   return result;
+}
+
+/**
+ * Cholesky factor L of a symmetric positive-definite matrix P = L * transpose( L ),
+ * such as a covariance matrix with RowDims == ColDims. L has rows of dimensions
+ * RowDims and dimensionless columns. Throws quantity_error if P is not positive definite.
+ */
+template< typename Dims, typename T >
+inline quantity_matrix< Dims, typename detail::list_repeat< Dims::size, dimensionless_d >::type, T >
+cholesky( quantity_matrix< Dims, Dims, T > const & m )
+{
+   enum { N = Dims::size };
+
+   detail::permit<T> const p;
+
+   quantity_matrix< Dims, typename detail::list_repeat< N, dimensionless_d >::type, T > L =
+      quantity_matrix< Dims, typename detail::list_repeat< N, dimensionless_d >::type, T >::zero();
+
+   for ( int j = 0; j < N; ++j )
+   {
+      T d = m.value( j, j, p );
+
+      for ( int k = 0; k < j; ++k )
+      {
+         d -= L.value( j, k, p ) * L.value( j, k, p );
+      }
+
+      if ( !( d > T( 0 ) ) )
+      {
+         throw quantity_error( "quantity: cholesky: matrix is not positive definite" );
+      }
+
+      T const ljj = std::sqrt( d );
+
+      L.value( j, j, p ) = ljj;
+
+      for ( int i = j + 1; i < N; ++i )
+      {
+         T s = m.value( i, j, p );
+
+         for ( int k = 0; k < j; ++k )
+         {
+            s -= L.value( i, k, p ) * L.value( j, k, p );
+         }
+         L.value( i, j, p ) = s / ljj;
+      }
+   }
+   return L;
+}
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_MATRIX_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,358 @@
+/**
+ * \file quantity_measurement.hpp
+ *
+ * \brief   Representation type with standard uncertainty, for quantity< Dims, measurement<> >.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * measurement<T> carries a value and its standard uncertainty through
+ * arithmetic with first-order (linear) propagation, e.g. for P = V * I:
+ *
+ *    quantity< electric_potential_d, measurement<> > v = measurement<>( 12.0, 0.1 ) * volt();
+ *    quantity< electric_current_d,   measurement<> > i = measurement<>(  2.0, 0.05 ) * ampere();
+ *    quantity< power_d, measurement<> > p = v * i;    // (24 +/- 0.63) W
+ *
+ * Measurements are independent unless they carry the same non-zero source
+ * id; these are taken to be fully correlated, so that x - x has zero
+ * uncertainty. A result keeps the source of its uncertain operands if they
+ * share it, and becomes independent (source 0) otherwise. Comparisons use
+ * the values only.
+ *
+ * nth_power(), nth_root(), sqrt(), abs(), fma(), hypot() and io:: output of
+ * quantities work through the pow(), sqrt(), fabs(), fma(), hypot() and
+ * operator<< found for measurement by argument-dependent lookup. For arrays, propagate_product() and
+ * propagate_quotient() take values and uncertainties in separate arrays of
+ * quantity< Dims, T >, a layout that the compiler can vectorise.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_MEASUREMENT_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_MEASUREMENT_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <cmath>
+#include <cstddef>  // for size_t
+#include <ostream>
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * first-order uncertainty from the contributions a * ux and b * uy, with correlation rho.
+ */
+template< typename T >
+inline T combine_uncertainty( T const a_ux, T const b_uy, T const rho )
+{
+   T const var = a_ux * a_ux + b_uy * b_uy + T( 2 ) * rho * a_ux * b_uy;
+
+   return std::sqrt( var < T( 0 ) ? T( 0 ) : var );
+}
+
+/**
+ * first-order uncertainty from the contributions a * ux and b * uy, independent.
+ */
+template< typename T >
+inline T combine_uncertainty( T const a_ux, T const b_uy )
+{
+   return std::sqrt( a_ux * a_ux + b_uy * b_uy );
+}
+
+} // namespace detail
+
+/**
+ * value with standard uncertainty.
+ */
+template< typename T = Rep >
+class measurement
+{
+public:
+   typedef T value_type;
+
+   measurement()
+   : m_value( 0 )
+   , m_uncertainty( 0 )
+   , m_source( 0 )
+   {
+   }
+
+   /**
+    * value with uncertainty >= 0; measurements with the same non-zero source are correlated.
+    */
+   measurement( T const & value, T const & uncertainty = T( 0 ), unsigned const source = 0 )
+   : m_value( value )
+   , m_uncertainty( uncertainty )
+   , m_source( source )
+   {
+   }
+
+   T value() const
+   {
+      return m_value;
+   }
+
+   T uncertainty() const
+   {
+      return m_uncertainty;
+   }
+
+   unsigned source() const
+   {
+      return m_source;
+   }
+
+   /**
+    * uncertainty relative to the magnitude of the value.
+    */
+   T relative_uncertainty() const
+   {
+      return m_uncertainty / std::fabs( m_value );
+   }
+
+   measurement & operator+=( measurement const & rhs )
+   {
+      return *this = *this + rhs;
+   }
+
+   measurement & operator-=( measurement const & rhs )
+   {
+      return *this = *this - rhs;
+   }
+
+   measurement & operator*=( measurement const & rhs )
+   {
+      return *this = *this * rhs;
+   }
+
+   measurement & operator/=( measurement const & rhs )
+   {
+      return *this = *this / rhs;
+   }
+
+   friend measurement operator+( measurement const & x )
+   {
+      return x;
+   }
+
+   friend measurement operator-( measurement const & x )
+   {
+      return measurement( -x.m_value, x.m_uncertainty, x.m_source );
+   }
+
+   friend measurement operator+( measurement const & x, measurement const & y )
+   {
+      return measurement( x.m_value + y.m_value,
+         detail::combine_uncertainty( x.m_uncertainty, y.m_uncertainty, correlation( x, y ) ), joint_source( x, y ) );
+   }
+
+   friend measurement operator-( measurement const & x, measurement const & y )
+   {
+      return measurement( x.m_value - y.m_value,
+         detail::combine_uncertainty( x.m_uncertainty, -y.m_uncertainty, correlation( x, y ) ), joint_source( x, y ) );
+   }
+
+   friend measurement operator*( measurement const & x, measurement const & y )
+   {
+      return measurement( x.m_value * y.m_value,
+         detail::combine_uncertainty( y.m_value * x.m_uncertainty, x.m_value * y.m_uncertainty, correlation( x, y ) ),
+         joint_source( x, y ) );
+   }
+
+   friend measurement operator/( measurement const & x, measurement const & y )
+   {
+      T const a = T( 1 ) / y.m_value;
+
+      return measurement( x.m_value * a,
+         detail::combine_uncertainty( a * x.m_uncertainty, -x.m_value * a * a * y.m_uncertainty, correlation( x, y ) ),
+         joint_source( x, y ) );
+   }
+
+   friend bool operator==( measurement const & x, measurement const & y ) { return x.m_value == y.m_value; }
+   friend bool operator!=( measurement const & x, measurement const & y ) { return x.m_value != y.m_value; }
+   friend bool operator< ( measurement const & x, measurement const & y ) { return x.m_value <  y.m_value; }
+   friend bool operator<=( measurement const & x, measurement const & y ) { return x.m_value <= y.m_value; }
+   friend bool operator> ( measurement const & x, measurement const & y ) { return x.m_value >  y.m_value; }
+   friend bool operator>=( measurement const & x, measurement const & y ) { return x.m_value >= y.m_value; }
+
+   friend measurement fabs( measurement const & x )
+   {
+      return measurement( std::fabs( x.m_value ), x.m_uncertainty, x.m_source );
+   }
+
+   friend measurement abs( measurement const & x )
+   {
+      return fabs( x );
+   }
+
+   friend measurement sqrt( measurement const & x )
+   {
+      T const z = std::sqrt( x.m_value );
+
+      return measurement( z, x.m_uncertainty / ( T( 2 ) * z ), x.m_source );
+   }
+
+   /**
+    * x * y + z, with the value rounded once if the platform provides fma().
+    */
+   friend measurement fma( measurement const & x, measurement const & y, measurement const & z )
+   {
+      measurement r = x * y + z;
+      r.m_value = detail::fma_( x.m_value, y.m_value, z.m_value );
+      return r;
+   }
+
+   /**
+    * sqrt( x * x + y * y ) without undue overflow or underflow; at zero the uncertainties do not contribute.
+    */
+   friend measurement hypot( measurement const & x, measurement const & y )
+   {
+      T const h = detail::hypot_( x.m_value, y.m_value );
+      T const a = h == T( 0 ) ? T( 0 ) : x.m_value / h;
+      T const b = h == T( 0 ) ? T( 0 ) : y.m_value / h;
+
+      return measurement( h,
+         detail::combine_uncertainty( a * x.m_uncertainty, b * y.m_uncertainty, correlation( x, y ) ),
+         joint_source( x, y ) );
+   }
+
+   friend measurement hypot( measurement const & x, measurement const & y, measurement const & z )
+   {
+      return hypot( hypot( x, y ), z );
+   }
+
+   /**
+    * x to the power y; an exact exponent does not contribute.
+    */
+   friend measurement pow( measurement const & x, measurement const & y )
+   {
+      T const z = std::pow( x.m_value, y.m_value );
+      T const a = y.m_value * std::pow( x.m_value, y.m_value - T( 1 ) );
+      T const b = y.m_uncertainty == T( 0 ) ? T( 0 ) : std::log( x.m_value ) * z;
+
+      return measurement( z,
+         detail::combine_uncertainty( a * x.m_uncertainty, b * y.m_uncertainty, correlation( x, y ) ),
+         joint_source( x, y ) );
+   }
+
+   /**
+    * write as (value +/- uncertainty).
+    */
+   friend std::ostream & operator<<( std::ostream & os, measurement const & x )
+   {
+      return os << "(" << x.m_value << " +/- " << x.m_uncertainty << ")";
+   }
+
+private:
+   /**
+    * 1 for correlated measurements, 0 for independent ones.
+    */
+   static T correlation( measurement const & x, measurement const & y )
+   {
+      return x.m_source != 0 && x.m_source == y.m_source ? T( 1 ) : T( 0 );
+   }
+
+   /**
+    * source of a result; exact operands do not count.
+    */
+   static unsigned joint_source( measurement const & x, measurement const & y )
+   {
+      return x.m_uncertainty == T( 0 ) ? y.m_source :
+             y.m_uncertainty == T( 0 ) ? x.m_source :
+             x.m_source == y.m_source  ? x.m_source : 0;
+   }
+
+   T m_value;
+   T m_uncertainty;
+   unsigned m_source;
+};
+
+/**
+ * measurement * quantity.
+ */
+template< typename Dims, typename T >
+inline quantity< Dims, measurement<T> >
+operator*( measurement<T> const & lhs, quantity< Dims, T > const & rhs )
+{
+   return quantity< Dims, measurement<T> >( detail::permit< measurement<T> >( lhs * detail::value_of( rhs ) ) );
+}
+
+/**
+ * quantity * measurement.
+ */
+template< typename Dims, typename T >
+inline quantity< Dims, measurement<T> >
+operator*( quantity< Dims, T > const & lhs, measurement<T> const & rhs )
+{
+   return quantity< Dims, measurement<T> >( detail::permit< measurement<T> >( detail::value_of( lhs ) * rhs ) );
+}
+
+/**
+ * quantity / measurement.
+ */
+template< typename Dims, typename T >
+inline quantity< Dims, measurement<T> >
+operator/( quantity< Dims, T > const & lhs, measurement<T> const & rhs )
+{
+   return quantity< Dims, measurement<T> >( detail::permit< measurement<T> >( detail::value_of( lhs ) / rhs ) );
+}
+
+/**
+ * values z = x * y and uncertainties uz of n independent pairs, stored as
+ * separate value and uncertainty arrays.
+ */
+template< typename XDims, typename YDims, typename T >
+void propagate_product(
+   quantity< XDims, T > const * x, quantity< XDims, T > const * ux,
+   quantity< YDims, T > const * y, quantity< YDims, T > const * uy, std::size_t const n,
+   typename detail::product< XDims, YDims, T >::type * z,
+   typename detail::product< XDims, YDims, T >::type * uz )
+{
+   typedef typename detail::product< XDims, YDims, T >::dimension_type dimension_type;
+
+   for ( std::size_t i = 0; i < n; ++i )
+   {
+      T const xv = detail::value_of( x[i] );
+      T const yv = detail::value_of( y[i] );
+
+      z[i]  = detail::from_value< dimension_type >( xv * yv );
+      uz[i] = detail::from_value< dimension_type >(
+         detail::combine_uncertainty( yv * detail::value_of( ux[i] ), xv * detail::value_of( uy[i] ) ) );
+   }
+}
+
+/**
+ * values z = x / y and uncertainties uz of n independent pairs, stored as
+ * separate value and uncertainty arrays.
+ */
+template< typename XDims, typename YDims, typename T >
+void propagate_quotient(
+   quantity< XDims, T > const * x, quantity< XDims, T > const * ux,
+   quantity< YDims, T > const * y, quantity< YDims, T > const * uy, std::size_t const n,
+   typename detail::quotient< XDims, YDims, T >::type * z,
+   typename detail::quotient< XDims, YDims, T >::type * uz )
+{
+   typedef typename detail::quotient< XDims, YDims, T >::dimension_type dimension_type;
+
+   for ( std::size_t i = 0; i < n; ++i )
+   {
+      T const xv = detail::value_of( x[i] );
+      T const a  = T( 1 ) / detail::value_of( y[i] );
+
+      z[i]  = detail::from_value< dimension_type >( xv * a );
+      uz[i] = detail::from_value< dimension_type >(
+         detail::combine_uncertainty( a * detail::value_of( ux[i] ), -xv * a * a * detail::value_of( uy[i] ) ) );
+   }
+}
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_MEASUREMENT_HPP_INCLUDED
+
+/*
+ * end of file
+ */
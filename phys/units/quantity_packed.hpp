@@ -0,0 +1,849 @@
+/**
+ * \file quantity_packed.hpp
+ *
+ * \brief   Arrays of quantities stored as scaled integer codes, with lazily decoded arithmetic.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * packed_quantity_array< Dims, CodeT, T > stores quantities as integer codes
+ * of type CodeT, e.g. std::int16_t for the samples of a 12 to 16-bit ADC.
+ * Element i has the value offset + scale * code[i], with a scale and offset
+ * per block of block_size elements. An int16 array takes a quarter of the
+ * memory of quantity< Dims, double > values.
+ *
+ * The scale and offset are either given, e.g. the least significant bit and
+ * zero of an ADC, or fitted to the range of each block of the data:
+ *
+ *    packed_quantity_array< electric_potential_d > u( n, 10 * volt() / 32768 );   // +/-10 V ADC
+ *    packed_quantity_array< electric_current_d > i( &current[0], n );            // fitted
+ *
+ * Values outside the range of the codes saturate. Signed codes use the
+ * symmetric range -max to max and keep the most negative code for NaN, e.g.
+ * a sensor dropout; it decodes to NaN, and sums and means over it are NaN.
+ * Unsigned codes have no spare code, and encoding NaN into them throws
+ * quantity_error. Elements are decoded on access; decode() and encode() convert ranges in block-wise loops that
+ * compilers vectorize.
+ *
+ * Arithmetic on arrays, with each other and with quantities and numbers,
+ * builds an expression that sum(), mean() and evaluate() decode in a single
+ * fused loop, without temporary arrays. The dimensions are checked at
+ * compile time, and arrays in one expression must have the same size and
+ * block size:
+ *
+ *    quantity< energy_d > e = sum( u * i ) * dt;
+ *    quantity< electric_potential_d > du = mean( u - 5 * volt() );
+ *
+ * sum() and mean() of an array add the integer codes of each block and
+ * apply the block's scale and offset once.
+ *
+ * This header requires C++11.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_PACKED_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_PACKED_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_packed.hpp requires C++11 or later
+#endif
+
+#include <algorithm>  // for find()
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int16_t, int64_t
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace ct { namespace phys { namespace units {
+
+template< typename Dims, typename CodeT, typename T > class packed_quantity_array;
+
+namespace detail {
+
+/**
+ * code that stands for NaN: the most negative code of a signed CodeT; none for an unsigned CodeT.
+ */
+template< typename CodeT >
+struct packed_nan_code
+{
+   enum { valid = std::is_signed< CodeT >::value };
+
+   static CodeT value()
+   {
+      return valid ? ( std::numeric_limits< CodeT >::min )() : CodeT( 0 );
+   }
+};
+
+/**
+ * value of code c with the given offset and scale; NaN for the NaN code.
+ */
+template< typename CodeT, typename T >
+inline T packed_decode( CodeT const c, T const offset, T const scale )
+{
+   return packed_nan_code< CodeT >::valid && c == packed_nan_code< CodeT >::value() ?
+      std::numeric_limits< T >::quiet_NaN() : offset + scale * T( c );
+}
+
+/**
+ * block-wise reader of a packed_quantity_array, an expression operand.
+ */
+template< typename Dims, typename CodeT, typename T >
+class packed_cursor
+{
+public:
+   typedef Dims dimension_type;
+   typedef T rep_type;
+
+   explicit packed_cursor( packed_quantity_array< Dims, CodeT, T > const & a )
+   : m_array( &a )
+   , m_codes( a.codes() )
+   , m_scale( 0 )
+   , m_offset( 0 )
+   , m_nan( false )
+   {
+   }
+
+   std::size_t size() const
+   {
+      return m_array->size();
+   }
+
+   std::size_t block_size() const
+   {
+      return m_array->block_size();
+   }
+
+   void block( std::size_t const b )
+   {
+      m_codes = m_array->codes() + b * m_array->block_size();
+      m_scale = value_of( m_array->scale( b ) );
+      m_offset = value_of( m_array->offset( b ) );
+      m_nan = m_array->has_nan( b );
+   }
+
+   T operator[]( std::size_t const k ) const
+   {
+      return m_nan ? packed_decode( m_codes[k], m_offset, m_scale ) : m_offset + m_scale * T( m_codes[k] );
+   }
+
+private:
+   packed_quantity_array< Dims, CodeT, T > const * m_array;
+   CodeT const * m_codes;
+   T m_scale;
+   T m_offset;
+   bool m_nan;
+};
+
+/**
+ * quantity or number in an expression.
+ */
+template< typename Dims, typename T >
+class packed_constant
+{
+public:
+   typedef Dims dimension_type;
+   typedef T rep_type;
+
+   explicit packed_constant( T const v )
+   : m_value( v )
+   {
+   }
+
+   std::size_t size() const
+   {
+      return 0;   // any
+   }
+
+   std::size_t block_size() const
+   {
+      return 0;
+   }
+
+   void block( std::size_t )
+   {
+   }
+
+   T operator[]( std::size_t ) const
+   {
+      return m_value;
+   }
+
+private:
+   T m_value;
+};
+
+struct packed_plus
+{
+   template< typename L, typename R, typename T >
+   struct result
+   {
+      static_assert( equal_dimensions< L, R >::value, "packed: operands of + must have the same dimensions" );
+
+      typedef L dimension_type;
+   };
+
+   template< typename T >
+   static T apply( T const a, T const b )
+   {
+      return a + b;
+   }
+};
+
+struct packed_minus
+{
+   template< typename L, typename R, typename T >
+   struct result
+   {
+      static_assert( equal_dimensions< L, R >::value, "packed: operands of - must have the same dimensions" );
+
+      typedef L dimension_type;
+   };
+
+   template< typename T >
+   static T apply( T const a, T const b )
+   {
+      return a - b;
+   }
+};
+
+struct packed_multiplies
+{
+   template< typename L, typename R, typename T >
+   struct result : product< L, R, T > {};
+
+   template< typename T >
+   static T apply( T const a, T const b )
+   {
+      return a * b;
+   }
+};
+
+struct packed_divides
+{
+   template< typename L, typename R, typename T >
+   struct result : quotient< L, R, T > {};
+
+   template< typename T >
+   static T apply( T const a, T const b )
+   {
+      return a / b;
+   }
+};
+
+} // namespace detail
+
+/**
+ * lazily decoded expression of packed arrays, quantities and numbers.
+ */
+template< typename L, typename R, typename Op >
+class packed_expression
+{
+public:
+   typedef typename L::rep_type rep_type;
+   typedef typename Op::template result< typename L::dimension_type, typename R::dimension_type, rep_type >::dimension_type dimension_type;
+
+   packed_expression( L const & l, R const & r )
+   : m_l( l )
+   , m_r( r )
+   {
+      if ( l.size() && r.size() && ( l.size() != r.size() || l.block_size() != r.block_size() ) )
+      {
+         throw quantity_error( "quantity: packed: arrays in an expression must have the same size and block size" );
+      }
+   }
+
+   std::size_t size() const
+   {
+      return m_l.size() ? m_l.size() : m_r.size();
+   }
+
+   std::size_t block_size() const
+   {
+      return m_l.size() ? m_l.block_size() : m_r.block_size();
+   }
+
+   void block( std::size_t const b )
+   {
+      m_l.block( b );
+      m_r.block( b );
+   }
+
+   rep_type operator[]( std::size_t const k ) const
+   {
+      return Op::apply( m_l[k], m_r[k] );
+   }
+
+private:
+   L m_l;
+   R m_r;
+};
+
+/**
+ * array of quantities stored as integer codes with a scale and offset per block.
+ */
+template< typename Dims, typename CodeT = std::int16_t, typename T = Rep >
+class packed_quantity_array
+{
+public:
+   typedef Dims dimension_type;
+   typedef CodeT code_type;
+   typedef T rep_type;
+   typedef quantity< Dims, T > value_type;
+
+   static_assert( std::is_integral< CodeT >::value, "packed: codes must be of integral type" );
+
+   enum { default_block_size = 4096 };
+
+   /**
+    * n elements with the given scale (value of one code step) and offset
+    * (value of code 0) in all blocks; the elements are offset.
+    */
+   packed_quantity_array( std::size_t const n, value_type const & scale, value_type const & offset = value_type( detail::permit< T >( 0 ) ), std::size_t const block_size = default_block_size )
+   : m_size( n )
+   , m_block_size( check_block_size( block_size ) )
+   , m_codes( n, CodeT( 0 ) )
+   , m_scale( block_count(), detail::value_of( scale ) )
+   , m_offset( block_count(), detail::value_of( offset ) )
+   , m_nan( block_count(), false )
+   {
+      if ( ! ( detail::value_of( scale ) != 0 ) )
+      {
+         throw quantity_error( "quantity: packed: scale must be non-zero" );
+      }
+   }
+
+   /**
+    * the n quantities at data, with scale and offset fitted to the range of
+    * each block, NaN values left out; throws quantity_error for NaN values
+    * and an unsigned CodeT.
+    */
+   packed_quantity_array( value_type const * const data, std::size_t const n, std::size_t const block_size = default_block_size )
+   : m_size( n )
+   , m_block_size( check_block_size( block_size ) )
+   , m_codes( n )
+   , m_scale( block_count() )
+   , m_offset( block_count() )
+   , m_nan( block_count(), false )
+   {
+      T const * const in = raw( data );
+
+      for ( std::size_t b = 0; b < block_count(); ++b )
+      {
+         std::size_t const first = b * m_block_size;
+         std::size_t const last = first + block_length( b );
+
+         // NaN fails both comparisons and is left out
+
+         T lo = std::numeric_limits< T >::infinity();
+         T hi = -std::numeric_limits< T >::infinity();
+         for ( std::size_t k = first; k < last; ++k )
+         {
+            lo = in[k] < lo ? in[k] : lo;
+            hi = in[k] > hi ? in[k] : hi;
+         }
+
+         // map [lo, hi] onto [code_min, code_max]; a constant block has code 0, an all-NaN block offset 0
+
+         lo = lo > hi ? T( 0 ) : lo;
+
+         if ( hi > lo )
+         {
+            m_scale[b] = ( hi - lo ) / ( T( code_max() ) - T( code_min() ) );
+            m_offset[b] = lo - m_scale[b] * T( code_min() );
+         }
+         else
+         {
+            m_scale[b] = 1;
+            m_offset[b] = lo;
+         }
+      }
+      encode( 0, data, n );
+   }
+
+   std::size_t size() const
+   {
+      return m_size;
+   }
+
+   bool empty() const
+   {
+      return m_size == 0;
+   }
+
+   std::size_t block_size() const
+   {
+      return m_block_size;
+   }
+
+   std::size_t block_count() const
+   {
+      return ( m_size + m_block_size - 1 ) / m_block_size;
+   }
+
+   /**
+    * memory taken by codes, scales and offsets, in bytes.
+    */
+   std::size_t bytes() const
+   {
+      return m_size * sizeof( CodeT ) + 2 * block_count() * sizeof( T );
+   }
+
+   /**
+    * value of one code step in block b.
+    */
+   value_type scale( std::size_t const b ) const
+   {
+      return value_type( detail::permit< T >( m_scale.at( b ) ) );
+   }
+
+   /**
+    * value of code 0 in block b.
+    */
+   value_type offset( std::size_t const b ) const
+   {
+      return value_type( detail::permit< T >( m_offset.at( b ) ) );
+   }
+
+   /**
+    * true if block b may hold the NaN code, i.e. NaN was stored in it.
+    */
+   bool has_nan( std::size_t const b ) const
+   {
+      return m_nan.at( b );
+   }
+
+   CodeT const * codes() const
+   {
+      return m_size ? &m_codes[0] : 0;
+   }
+
+   /**
+    * element i, decoded.
+    */
+   value_type operator[]( std::size_t const i ) const
+   {
+      std::size_t const b = i / m_block_size;
+
+      return value_type( detail::permit< T >( detail::packed_decode( m_codes[i], m_offset[b], m_scale[b] ) ) );
+   }
+
+   /**
+    * set element i to v, rounded to the nearest code and saturated; throws
+    * quantity_error if v is NaN and CodeT is unsigned.
+    */
+   void set( std::size_t const i, value_type const & v )
+   {
+      std::size_t const b = i / m_block_size;
+
+      T const x = detail::value_of( v );
+
+      if ( x != x )
+      {
+         check_nan();
+         m_nan.at( b ) = true;
+      }
+      m_codes.at( i ) = to_code( ( x - m_offset[b] ) / m_scale[b] );
+   }
+
+   /**
+    * decode the n elements from first to out.
+    */
+   void decode( std::size_t first, std::size_t n, value_type * const out ) const
+   {
+      T * o = raw( out );
+
+      while ( n > 0 )
+      {
+         std::size_t const b = first / m_block_size;
+         std::size_t const m = chunk( first, n );
+
+         T const scale = m_scale[b];
+         T const offset = m_offset[b];
+         CodeT const * const c = &m_codes[first];
+
+         if ( m_nan[b] )
+         {
+            for ( std::size_t k = 0; k < m; ++k )
+            {
+               o[k] = detail::packed_decode( c[k], offset, scale );
+            }
+         }
+         else
+         {
+            for ( std::size_t k = 0; k < m; ++k )
+            {
+               o[k] = offset + scale * T( c[k] );
+            }
+         }
+         first += m;
+         n -= m;
+         o += m;
+      }
+   }
+
+   /**
+    * encode the n quantities at data into the elements from first, rounded
+    * and saturated; throws quantity_error for NaN values and an unsigned
+    * CodeT, after encoding them as code 0.
+    */
+   void encode( std::size_t first, value_type const * const data, std::size_t n )
+   {
+      T const * in = raw( data );
+
+      while ( n > 0 )
+      {
+         std::size_t const b = first / m_block_size;
+         std::size_t const m = chunk( first, n );
+
+         T const inv_scale = T( 1 ) / m_scale[b];
+         T const offset = m_offset[b];
+         CodeT * const c = &m_codes[first];
+
+         bool nan = false;
+         for ( std::size_t k = 0; k < m; ++k )
+         {
+            c[k] = to_code( ( in[k] - offset ) * inv_scale );
+            nan |= in[k] != in[k];
+         }
+         if ( nan )
+         {
+            check_nan();
+            m_nan[b] = true;
+         }
+         first += m;
+         n -= m;
+         in += m;
+      }
+   }
+
+private:
+   static CodeT code_min()
+   {
+      // symmetric range for signed codes
+
+      return std::is_signed< CodeT >::value ? CodeT( - std::numeric_limits< CodeT >::max() ) : CodeT( 0 );
+   }
+
+   static CodeT code_max()
+   {
+      return std::numeric_limits< CodeT >::max();
+   }
+
+   /**
+    * nearest code to c, saturated; the NaN code for NaN, or 0 without one.
+    */
+   static CodeT to_code( T c )
+   {
+      bool const nan = c != c;
+
+      c = c < T( code_min() ) ? T( code_min() ) : c;
+      c = c > T( code_max() ) ? T( code_max() ) : c;
+      c = nan ? T( 0 ) : c;
+
+      CodeT const r = CodeT( c < 0 ? c - T( 0.5 ) : c + T( 0.5 ) );
+
+      return nan ? detail::packed_nan_code< CodeT >::value() : r;
+   }
+
+   static void check_nan()
+   {
+      if ( ! detail::packed_nan_code< CodeT >::valid )
+      {
+         throw quantity_error( "quantity: packed: unsigned codes cannot hold NaN" );
+      }
+   }
+
+   static std::size_t check_block_size( std::size_t const block_size )
+   {
+      if ( block_size == 0 )
+      {
+         throw quantity_error( "quantity: packed: block size must be positive" );
+      }
+      return block_size;
+   }
+
+   std::size_t block_length( std::size_t const b ) const
+   {
+      std::size_t const first = b * m_block_size;
+
+      return m_size - first < m_block_size ? m_size - first : m_block_size;
+   }
+
+   /**
+    * elements from first to the end of its block, at most n.
+    */
+   std::size_t chunk( std::size_t const first, std::size_t const n ) const
+   {
+      std::size_t const m = m_block_size - first % m_block_size;
+
+      return m < n ? m : n;
+   }
+
+   static T * raw( value_type * const p )
+   {
+      static_assert( sizeof( value_type ) == sizeof( T ), "quantity must have the layout of its representation type" );
+
+      return reinterpret_cast< T * >( p );
+   }
+
+   static T const * raw( value_type const * const p )
+   {
+      return reinterpret_cast< T const * >( p );
+   }
+
+   std::size_t m_size;
+   std::size_t m_block_size;
+   std::vector< CodeT > m_codes;
+   std::vector< T > m_scale;
+   std::vector< T > m_offset;
+   std::vector< bool > m_nan;
+};
+
+namespace detail {
+
+/**
+ * expression operand for packed arrays, expressions, quantities and numbers with representation type T.
+ */
+template< typename X, typename T, typename Enable = void >
+struct packed_operand
+{
+   enum { packed = false, valid = false };
+};
+
+template< typename Dims, typename CodeT, typename T >
+struct packed_operand< packed_quantity_array< Dims, CodeT, T >, T >
+{
+   enum { packed = true, valid = true };
+
+   typedef packed_cursor< Dims, CodeT, T > type;
+
+   static type make( packed_quantity_array< Dims, CodeT, T > const & a )
+   {
+      return type( a );
+   }
+};
+
+template< typename L, typename R, typename Op, typename T >
+struct packed_operand< packed_expression< L, R, Op >, T, typename std::enable_if< std::is_same< typename L::rep_type, T >::value >::type >
+{
+   enum { packed = true, valid = true };
+
+   typedef packed_expression< L, R, Op > type;
+
+   static type const & make( type const & e )
+   {
+      return e;
+   }
+};
+
+template< typename Dims, typename Y, typename T >
+struct packed_operand< quantity< Dims, Y >, T >
+{
+   enum { packed = false, valid = true };
+
+   typedef packed_constant< Dims, T > type;
+
+   static type make( quantity< Dims, Y > const & q )
+   {
+      return type( T( value_of( q ) ) );
+   }
+};
+
+template< typename Y, typename T >
+struct packed_operand< Y, T, typename std::enable_if< std::is_arithmetic< Y >::value >::type >
+{
+   enum { packed = false, valid = true };
+
+   typedef packed_constant< dimensionless_d, T > type;
+
+   static type make( Y const v )
+   {
+      return type( T( v ) );
+   }
+};
+
+/**
+ * representation type of a packed array or expression, void otherwise.
+ */
+template< typename X >
+struct packed_rep
+{
+   typedef void type;
+};
+
+template< typename Dims, typename CodeT, typename T >
+struct packed_rep< packed_quantity_array< Dims, CodeT, T > >
+{
+   typedef T type;
+};
+
+template< typename L, typename R, typename Op >
+struct packed_rep< packed_expression< L, R, Op > >
+{
+   typedef typename L::rep_type type;
+};
+
+/**
+ * expression type of L Op R if at least one is packed, no type otherwise.
+ */
+template< typename L, typename R, typename Op,
+   typename T = typename std::conditional< std::is_void< typename packed_rep< L >::type >::value, typename packed_rep< R >::type, typename packed_rep< L >::type >::type,
+   bool = std::is_void< T >::value >
+struct packed_binary
+{
+};
+
+template< typename L, typename R, typename Op, typename T >
+struct packed_binary< L, R, Op, T, false >
+{
+   typedef packed_operand< L, T > lhs;
+   typedef packed_operand< R, T > rhs;
+
+   typedef typename std::enable_if< lhs::valid && rhs::valid,
+      packed_expression< typename lhs::type, typename rhs::type, Op > >::type type;
+
+   static type make( L const & l, R const & r )
+   {
+      return type( lhs::make( l ), rhs::make( r ) );
+   }
+};
+
+/**
+ * call f( block, length ) for each block of e, after moving e to the block.
+ */
+template< typename E, typename F >
+inline void packed_for_each_block( E & e, F f )
+{
+   std::size_t const n = e.size();
+   std::size_t const bs = e.block_size();
+
+   for ( std::size_t first = 0, b = 0; first < n; first += bs, ++b )
+   {
+      e.block( b );
+      f( first, n - first < bs ? n - first : bs );
+   }
+}
+
+} // namespace detail
+
+#define PHYS_UNITS_PACKED_OPERATOR( op, name ) \
+template< typename L, typename R > \
+inline typename detail::packed_binary< L, R, detail::name >::type operator op( L const & l, R const & r ) \
+{ \
+   return detail::packed_binary< L, R, detail::name >::make( l, r ); \
+}
+
+PHYS_UNITS_PACKED_OPERATOR( +, packed_plus )
+PHYS_UNITS_PACKED_OPERATOR( -, packed_minus )
+PHYS_UNITS_PACKED_OPERATOR( *, packed_multiplies )
+PHYS_UNITS_PACKED_OPERATOR( /, packed_divides )
+
+#undef PHYS_UNITS_PACKED_OPERATOR
+
+/**
+ * sum of the elements of an expression, decoded in one loop; four partial sums.
+ */
+template< typename L, typename R, typename Op >
+inline typename detail::collapse< typename packed_expression< L, R, Op >::dimension_type, typename L::rep_type >::type
+sum( packed_expression< L, R, Op > e )
+{
+   typedef typename L::rep_type T;
+
+   T total( 0 );
+   detail::packed_for_each_block( e, [&]( std::size_t, std::size_t const m )
+   {
+      T s0( 0 ), s1( 0 ), s2( 0 ), s3( 0 );
+      std::size_t k = 0;
+      for ( ; k + 4 <= m; k += 4 )
+      {
+         s0 += e[k];
+         s1 += e[k + 1];
+         s2 += e[k + 2];
+         s3 += e[k + 3];
+      }
+      for ( ; k < m; ++k )
+      {
+         s0 += e[k];
+      }
+      total += ( s0 + s1 ) + ( s2 + s3 );
+   } );
+   return detail::from_value< typename packed_expression< L, R, Op >::dimension_type >( total );
+}
+
+/**
+ * sum of the elements of an array, from the sums of the codes per block.
+ */
+template< typename Dims, typename CodeT, typename T >
+inline typename detail::collapse< Dims, T >::type
+sum( packed_quantity_array< Dims, CodeT, T > const & a )
+{
+   T total( 0 );
+   for ( std::size_t b = 0; b < a.block_count(); ++b )
+   {
+      std::size_t const first = b * a.block_size();
+      std::size_t const m = a.size() - first < a.block_size() ? a.size() - first : a.block_size();
+      CodeT const * const c = a.codes() + first;
+
+      if ( a.has_nan( b ) && std::find( c, c + m, detail::packed_nan_code< CodeT >::value() ) != c + m )
+      {
+         total += std::numeric_limits< T >::quiet_NaN();
+         continue;
+      }
+
+      std::int64_t s = 0;
+      for ( std::size_t k = 0; k < m; ++k )
+      {
+         s += c[k];
+      }
+      total += detail::value_of( a.offset( b ) ) * T( m ) + detail::value_of( a.scale( b ) ) * T( s );
+   }
+   return detail::from_value< Dims >( total );
+}
+
+/**
+ * mean of the elements of an array or expression; throws quantity_error if it is empty.
+ */
+template< typename E >
+inline auto mean( E const & e ) -> decltype( sum( e ) / typename detail::packed_rep< E >::type( 1 ) )
+{
+   if ( e.size() == 0 )
+   {
+      throw quantity_error( "quantity: packed: mean of an empty array" );
+   }
+   return sum( e ) / typename detail::packed_rep< E >::type( e.size() );
+}
+
+/**
+ * decoded elements of an expression, written to out.
+ */
+template< typename L, typename R, typename Op >
+inline void evaluate( packed_expression< L, R, Op > e,
+   quantity< typename packed_expression< L, R, Op >::dimension_type, typename L::rep_type > * const out )
+{
+   typedef typename L::rep_type T;
+
+   T * const o = reinterpret_cast< T * >( out );
+
+   detail::packed_for_each_block( e, [&]( std::size_t const first, std::size_t const m )
+   {
+      for ( std::size_t k = 0; k < m; ++k )
+      {
+         o[ first + k ] = e[k];
+      }
+   } );
+}
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_PACKED_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,374 @@
+/**
+ * \file quantity_polynomial.hpp
+ *
+ * \brief   Polynomials in a quantity with per-coefficient dimensions.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * polynomial<XDims, YDims, Degree> represents y = c0 + c1 x + ... + cN x^N,
+ * where coefficient cK has dimensions YDims / XDims^K, e.g. a heat capacity
+ * versus temperature:
+ *
+ *    polynomial< thermodynamic_temperature_d, heat_capacity_d, 2 > cp(
+ *       a * joule() / kelvin(),
+ *       b * joule() / kelvin() / kelvin(),
+ *       c * joule() / kelvin() / kelvin() / kelvin() );
+ *
+ *    quantity< heat_capacity_d > cp300 = cp( 300 * kelvin() );
+ *
+ * operator() uses Horner's scheme, estrin() uses Estrin's scheme, which has
+ * a shorter dependency chain for higher degrees. Both use std::fma() when the
+ * implementation reports it as fast for T (FP_FAST_FMAF, FP_FAST_FMA or
+ * FP_FAST_FMAL), else a multiply and an add.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_POLYNOMIAL_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_POLYNOMIAL_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <cmath>    // for FP_FAST_FMA, FP_FAST_FMAF, FP_FAST_FMAL
+#include <cstddef>  // for size_t
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * true if the implementation reports fma for T as fast.
+ */
+template< typename T >
+struct fast_fma
+{
+   enum { value = false };
+};
+
+#ifdef FP_FAST_FMAF
+template<>
+struct fast_fma< float >
+{
+   enum { value = true };
+};
+#endif
+
+#ifdef FP_FAST_FMA
+template<>
+struct fast_fma< double >
+{
+   enum { value = true };
+};
+#endif
+
+#ifdef FP_FAST_FMAL
+template<>
+struct fast_fma< long double >
+{
+   enum { value = true };
+};
+#endif
+
+/**
+ * x * y + z, fused if the implementation reports fma for T as fast.
+ */
+template< typename T >
+inline T poly_madd( T const x, T const y, T const z )
+{
+   return fast_fma< T >::value ? fma_( x, y, z ) : x * y + z;
+}
+
+/**
+ * largest power of two below N (one for N = 1), and its base-two logarithm.
+ */
+template< int N, int P = 1, int L = 0, bool Done = ( 2 * P >= N ) >
+struct estrin_split
+{
+   enum
+   {
+      half  = estrin_split< N, 2 * P, L + 1 >::half,
+      level = estrin_split< N, 2 * P, L + 1 >::level,
+   };
+};
+
+template< int N, int P, int L >
+struct estrin_split< N, P, L, true >
+{
+   enum { half = P, level = L };
+};
+
+/**
+ * Estrin's scheme for coefficients c[Lo..Lo+Count), given p[j] = x^(2^j):
+ * low part + x^half * high part, unrolled at compile time.
+ */
+template< typename T, int Lo, int Count >
+struct estrin_step
+{
+   enum
+   {
+      half  = estrin_split< Count >::half,
+      level = estrin_split< Count >::level,
+   };
+
+   static T eval( T const * c, T const * p )
+   {
+      return poly_madd(
+         estrin_step< T, Lo + half, Count - half >::eval( c, p ), p[level],
+         estrin_step< T, Lo, half >::eval( c, p ) );
+   }
+};
+
+template< typename T, int Lo >
+struct estrin_step< T, Lo, 1 >
+{
+   static T eval( T const * c, T const * )
+   {
+      return c[Lo];
+   }
+};
+
+} // namespace detail
+
+/**
+ * polynomial of degree Degree in a quantity with dimensions XDims,
+ * with a value with dimensions YDims.
+ */
+template< typename XDims, typename YDims, int Degree, typename T = Rep >
+class polynomial
+{
+public:
+   enum { degree = Degree, size = Degree + 1 };
+
+   typedef TYPENAME_TYPE_K detail::collapse< XDims, T >::type key_type;
+   typedef TYPENAME_TYPE_K detail::collapse< YDims, T >::type value_type;
+
+   /**
+    * type of coefficient K, dimensions YDims / XDims^K.
+    */
+   template< int K >
+   struct coefficient
+   {
+      typedef TYPENAME_TYPE_K detail::quotient< YDims,
+         TYPENAME_TYPE_K detail::power< XDims, K, T >::dimension_type, T >::dimension_type dimension_type;
+
+      typedef TYPENAME_TYPE_K detail::collapse< dimension_type, T >::type type;
+   };
+
+   /**
+    * polynomial with all coefficients zero.
+    */
+   polynomial()
+   {
+      for ( int k = 0; k < size; ++k )
+      {
+         m_c[k] = T( 0 );
+      }
+   }
+
+   /**
+    * polynomial of degree one, c0 + c1 x.
+    */
+   polynomial(
+      typename coefficient<0>::type const & c0,
+      typename coefficient<1>::type const & c1 )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( Degree == 1, "number of coefficients must be degree plus one" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( Degree == 1, number_of_coefficients_must_be_degree_plus_one );
+      (void) sizeof( ERROR__number_of_coefficients_must_be_degree_plus_one );
+#endif
+
+      m_c[0] = detail::value_of( c0 );
+      m_c[1] = detail::value_of( c1 );
+   }
+
+   /**
+    * polynomial of degree two.
+    */
+   polynomial(
+      typename coefficient<0>::type const & c0,
+      typename coefficient<1>::type const & c1,
+      typename coefficient<2>::type const & c2 )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( Degree == 2, "number of coefficients must be degree plus one" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( Degree == 2, number_of_coefficients_must_be_degree_plus_one );
+      (void) sizeof( ERROR__number_of_coefficients_must_be_degree_plus_one );
+#endif
+
+      m_c[0] = detail::value_of( c0 );
+      m_c[1] = detail::value_of( c1 );
+      m_c[2] = detail::value_of( c2 );
+   }
+
+   /**
+    * polynomial of degree three.
+    */
+   polynomial(
+      typename coefficient<0>::type const & c0,
+      typename coefficient<1>::type const & c1,
+      typename coefficient<2>::type const & c2,
+      typename coefficient<3>::type const & c3 )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( Degree == 3, "number of coefficients must be degree plus one" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( Degree == 3, number_of_coefficients_must_be_degree_plus_one );
+      (void) sizeof( ERROR__number_of_coefficients_must_be_degree_plus_one );
+#endif
+
+      m_c[0] = detail::value_of( c0 );
+      m_c[1] = detail::value_of( c1 );
+      m_c[2] = detail::value_of( c2 );
+      m_c[3] = detail::value_of( c3 );
+   }
+
+   /**
+    * polynomial of degree four, e.g. the heat capacity part of the NASA polynomials.
+    */
+   polynomial(
+      typename coefficient<0>::type const & c0,
+      typename coefficient<1>::type const & c1,
+      typename coefficient<2>::type const & c2,
+      typename coefficient<3>::type const & c3,
+      typename coefficient<4>::type const & c4 )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( Degree == 4, "number of coefficients must be degree plus one" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( Degree == 4, number_of_coefficients_must_be_degree_plus_one );
+      (void) sizeof( ERROR__number_of_coefficients_must_be_degree_plus_one );
+#endif
+
+      m_c[0] = detail::value_of( c0 );
+      m_c[1] = detail::value_of( c1 );
+      m_c[2] = detail::value_of( c2 );
+      m_c[3] = detail::value_of( c3 );
+      m_c[4] = detail::value_of( c4 );
+   }
+
+   /**
+    * coefficient K.
+    */
+   template< int K >
+   typename coefficient<K>::type get() const
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( K >= 0 && K <= Degree, "coefficient index must not exceed degree" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( K >= 0 && K <= Degree, coefficient_index_must_not_exceed_degree );
+      (void) sizeof( ERROR__coefficient_index_must_not_exceed_degree );
+#endif
+
+      return detail::from_value< TYPENAME_TYPE_K coefficient<K>::dimension_type, T >( m_c[K] );
+   }
+
+   /**
+    * set coefficient K.
+    */
+   template< int K >
+   polynomial & set( typename coefficient<K>::type const & c )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( K >= 0 && K <= Degree, "coefficient index must not exceed degree" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( K >= 0 && K <= Degree, coefficient_index_must_not_exceed_degree );
+      (void) sizeof( ERROR__coefficient_index_must_not_exceed_degree );
+#endif
+
+      m_c[K] = detail::value_of( c );
+      return *this;
+   }
+
+   /**
+    * value at x, Horner's scheme.
+    */
+   value_type operator()( key_type const & x ) const
+   {
+      return detail::from_value< YDims, T >( horner_scheme( detail::value_of( x ) ) );
+   }
+
+   /**
+    * values at x[0..n) into out[0..n), Horner's scheme.
+    */
+   void operator()( key_type const * x, std::size_t const n, value_type * out ) const
+   {
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         out[i] = detail::from_value< YDims, T >( horner_scheme( detail::value_of( x[i] ) ) );
+      }
+   }
+
+   /**
+    * value at x, Estrin's scheme.
+    */
+   value_type estrin( key_type const & x ) const
+   {
+      return detail::from_value< YDims, T >( estrin_scheme( detail::value_of( x ) ) );
+   }
+
+   /**
+    * values at x[0..n) into out[0..n), Estrin's scheme.
+    */
+   void estrin( key_type const * x, std::size_t const n, value_type * out ) const
+   {
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         out[i] = detail::from_value< YDims, T >( estrin_scheme( detail::value_of( x[i] ) ) );
+      }
+   }
+
+   /**
+    * representation value of coefficient k; for use by the library only.
+    */
+   T value( int const k, detail::permit<T> ) const
+   {
+      return m_c[k];
+   }
+
+private:
+   T horner_scheme( T const x ) const
+   {
+      T r = m_c[Degree];
+
+      for ( int k = Degree - 1; k >= 0; --k )
+      {
+         r = detail::poly_madd( r, x, m_c[k] );
+      }
+      return r;
+   }
+
+   T estrin_scheme( T const x ) const
+   {
+      // x, x^2, x^4, ...
+
+      enum { levels = detail::estrin_split< size >::level + 1 };
+
+      T p[levels];
+
+      p[0] = x;
+
+      for ( int j = 1; j < levels; ++j )
+      {
+         p[j] = p[j - 1] * p[j - 1];
+      }
+
+      return detail::estrin_step< T, 0, size >::eval( m_c, p );
+   }
+
+private:
+   T m_c[size];
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_POLYNOMIAL_HPP_INCLUDED
+
+/*
+ * end of file
+ */
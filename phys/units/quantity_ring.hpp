@@ -0,0 +1,479 @@
+/**
+ * \file quantity_ring.hpp
+ *
+ * \brief   Lock-free shared-memory ring buffer for passing batches of quantities between processes.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * quantity_ring is a bounded queue of batches in POSIX shared memory. Each
+ * slot carries the dimensions, value type and count of its batch, followed
+ * by the raw values. The producing process creates the ring, the consuming
+ * process opens it by name:
+ *
+ *    quantity_ring ring( "/acquisition", 1024, 64 * 1024 );   // 1024 slots of 64 kB
+ *    ...
+ *    while ( ! ring.try_push( &u[0], u.size() ) ) {}       // ring full: wait
+ *
+ *    quantity_ring ring( "/acquisition" );
+ *    ...
+ *    if ( ! ring.empty() )
+ *    {
+ *       column_view< electric_potential_d > u = ring.front< electric_potential_d >();
+ *       ...
+ *       ring.pop();
+ *    }
+ *
+ * front() checks the dimensions and value type of the batch against the
+ * requested quantity and throws quantity_error if they differ; holds()
+ * checks without throwing. The view refers to the values in the shared
+ * memory and is valid until pop().
+ *
+ * Slots follow a sequence number protocol: a slot's sequence tells whether
+ * it is free for the producer at position pos (pos) or holds the batch for
+ * the consumer at position pos (pos + 1). A ring created for a single
+ * producer claims slots with a plain store; one created for multiple
+ * producers claims them with compare-and-swap. There is one consumer.
+ *
+ * The object that created the ring removes its name when destroyed; rings
+ * already opened stay mapped.
+ *
+ * This header requires C++11 (std::atomic, lock-free for 64 bits) and POSIX
+ * shared memory (shm_open, mmap).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_RING_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_RING_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"            // for quantity_error
+#include "phys/units/quantity_column_file.hpp"   // for column_view, column_kind
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_ring.hpp requires C++11 or later
+#endif
+
+#ifdef _WIN32
+# error quantity_ring.hpp requires POSIX shared memory
+#endif
+
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <cstring>  // for memcpy, memcmp
+#include <new>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+static_assert( ATOMIC_LLONG_LOCK_FREE == 2, "quantity_ring requires lock-free 64-bit atomics" );
+
+/**
+ * ring header: description, producer position and consumer position, each on its own cache line.
+ */
+struct ring_header
+{
+   char magic[8];
+   std::uint32_t byte_order;
+   std::uint32_t version;
+   std::uint64_t slots;
+   std::uint64_t capacity;
+   std::uint64_t slot_bytes;
+   std::uint32_t multi_producer;
+   std::uint32_t reserved[5];
+
+   std::atomic< std::uint64_t > head;
+   char pad1[ 64 - sizeof( std::atomic< std::uint64_t > ) ];
+
+   std::atomic< std::uint64_t > tail;
+   char pad2[ 64 - sizeof( std::atomic< std::uint64_t > ) ];
+};
+
+/**
+ * slot header, followed by the values of the batch.
+ */
+struct ring_slot
+{
+   std::atomic< std::uint64_t > sequence;
+   signed char dim[8];
+   char kind;
+   unsigned char size;
+   unsigned char reserved[6];
+   std::uint64_t count;
+   char pad[ 64 - 3 * sizeof( std::uint64_t ) - sizeof( std::atomic< std::uint64_t > ) ];
+};
+
+static_assert( sizeof( ring_header ) == 192, "ring header must be 192 bytes" );
+static_assert( sizeof( ring_slot ) == 64, "ring slot header must be 64 bytes" );
+
+char const ring_magic[8] = "PHYSRNG";
+
+std::uint32_t const ring_byte_order = 0x01020304u;
+
+} // namespace detail
+
+/**
+ * shared-memory ring buffer of quantity batches.
+ */
+class quantity_ring
+{
+public:
+   enum producers { single_producer, multi_producer };
+
+   /**
+    * create ring name with slots slots (a power of two) of capacity bytes of
+    * values each, replacing an existing ring of that name; throws quantity_error on failure.
+    */
+   quantity_ring( std::string const & name, std::size_t const slots, std::size_t const capacity, producers const mode = single_producer )
+   : m_name( name )
+   , m_owner( true )
+   , m_base( 0 )
+   , m_bytes( 0 )
+   {
+      if ( slots == 0 || ( slots & ( slots - 1 ) ) != 0 )
+      {
+         throw quantity_error( "quantity: ring: number of slots must be a power of two" );
+      }
+
+      std::size_t const slot_bytes = sizeof( detail::ring_slot ) + ( capacity + 63 ) / 64 * 64;
+
+      m_bytes = sizeof( detail::ring_header ) + slots * slot_bytes;
+
+      ::shm_unlink( name.c_str() );
+
+      int const fd = ::shm_open( name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+      if ( fd < 0 )
+      {
+         throw quantity_error( "quantity: ring: cannot create '" + name + "'" );
+      }
+      if ( ::ftruncate( fd, static_cast< off_t >( m_bytes ) ) != 0 )
+      {
+         ::close( fd );
+         ::shm_unlink( name.c_str() );
+         throw quantity_error( "quantity: ring: cannot size '" + name + "'" );
+      }
+      map( fd );
+
+      detail::ring_header * const h = new ( m_base ) detail::ring_header();
+      h->byte_order = detail::ring_byte_order;
+      h->version = 1;
+      h->slots = slots;
+      h->capacity = capacity;
+      h->slot_bytes = slot_bytes;
+      h->multi_producer = mode == multi_producer;
+      h->head.store( 0, std::memory_order_relaxed );
+      h->tail.store( 0, std::memory_order_relaxed );
+
+      for ( std::size_t i = 0; i < slots; ++i )
+      {
+         detail::ring_slot * const s = new ( m_base + sizeof( detail::ring_header ) + i * slot_bytes ) detail::ring_slot();
+         s->sequence.store( i, std::memory_order_relaxed );
+      }
+
+      // the magic marks the ring as ready for open
+
+      std::atomic_thread_fence( std::memory_order_release );
+      std::memcpy( h->magic, detail::ring_magic, sizeof h->magic );
+   }
+
+   /**
+    * open existing ring name; throws quantity_error if there is none.
+    */
+   explicit quantity_ring( std::string const & name )
+   : m_name( name )
+   , m_owner( false )
+   , m_base( 0 )
+   , m_bytes( 0 )
+   {
+      int const fd = ::shm_open( name.c_str(), O_RDWR, 0 );
+      if ( fd < 0 )
+      {
+         throw quantity_error( "quantity: ring: cannot open '" + name + "'" );
+      }
+      struct stat st;
+      if ( ::fstat( fd, &st ) != 0 || st.st_size < static_cast< off_t >( sizeof( detail::ring_header ) ) )
+      {
+         ::close( fd );
+         throw quantity_error( "quantity: ring: '" + name + "' is not a ring" );
+      }
+      m_bytes = static_cast< std::size_t >( st.st_size );
+      map( fd );
+
+      detail::ring_header const & h = header();
+
+      if ( std::memcmp( h.magic, detail::ring_magic, sizeof h.magic ) != 0
+         || h.byte_order != detail::ring_byte_order
+         || h.version != 1
+         || h.slots == 0 || ( h.slots & ( h.slots - 1 ) ) != 0
+         || h.slot_bytes < sizeof( detail::ring_slot ) + h.capacity
+         || m_bytes < sizeof( detail::ring_header ) + h.slots * h.slot_bytes )
+      {
+         ::munmap( m_base, m_bytes );
+         throw quantity_error( "quantity: ring: '" + name + "' is not a ring" );
+      }
+      std::atomic_thread_fence( std::memory_order_acquire );
+   }
+
+   ~quantity_ring()
+   {
+      ::munmap( m_base, m_bytes );
+
+      if ( m_owner )
+      {
+         ::shm_unlink( m_name.c_str() );
+      }
+   }
+
+   quantity_ring( quantity_ring const & ) = delete;
+   quantity_ring & operator=( quantity_ring const & ) = delete;
+
+   /**
+    * number of slots.
+    */
+   std::size_t slots() const
+   {
+      return static_cast< std::size_t >( header().slots );
+   }
+
+   /**
+    * bytes of values per slot.
+    */
+   std::size_t capacity() const
+   {
+      return static_cast< std::size_t >( header().capacity );
+   }
+
+   /**
+    * copy the n quantities at data into a free slot; false if the ring is
+    * full, throws quantity_error if they exceed the capacity of a slot.
+    */
+   template< typename Dims, typename T >
+   bool try_push( quantity< Dims, T > const * const data, std::size_t const n )
+   {
+      static_assert( sizeof( quantity< Dims, T > ) == sizeof( T ), "quantity must have the layout of its representation type" );
+
+      if ( n > capacity() / sizeof( T ) )
+      {
+         throw quantity_error( "quantity: ring: batch exceeds the capacity of a slot" );
+      }
+
+      std::uint64_t pos;
+      detail::ring_slot * s;
+
+      if ( ! claim( pos, s ) )
+      {
+         return false;
+      }
+
+      s->dim[0] = Dims::dim1;
+      s->dim[1] = Dims::dim2;
+      s->dim[2] = Dims::dim3;
+      s->dim[3] = Dims::dim4;
+      s->dim[4] = Dims::dim5;
+      s->dim[5] = Dims::dim6;
+      s->dim[6] = Dims::dim7;
+      s->kind = detail::column_kind<T>::value;
+      s->size = sizeof( T );
+      s->count = n;
+
+      if ( n > 0 )
+      {
+         std::memcpy( values( s ), data, n * sizeof( T ) );
+      }
+
+      s->sequence.store( pos + 1, std::memory_order_release );
+      return true;
+   }
+
+   /**
+    * true if there is no batch to read.
+    */
+   bool empty() const
+   {
+      return ready() == 0;
+   }
+
+   /**
+    * true if the next batch holds quantities with dimensions Dims of type T.
+    */
+   template< typename Dims, typename T = Rep >
+   bool holds() const
+   {
+      detail::ring_slot const * const s = ready();
+
+      return s && matches< Dims, T >( *s );
+   }
+
+   /**
+    * zero-copy view of the next batch, valid until pop(); throws
+    * quantity_error if there is none or it holds other quantities.
+    */
+   template< typename Dims, typename T = Rep >
+   column_view< Dims, T > front() const
+   {
+      detail::ring_slot const * const s = ready();
+
+      if ( ! s )
+      {
+         throw quantity_error( "quantity: ring: no batch to read" );
+      }
+      if ( ! matches< Dims, T >( *s ) )
+      {
+         throw quantity_error( "quantity: ring: batch has different dimensions or value type" );
+      }
+      return column_view< Dims, T >(
+         reinterpret_cast< quantity< Dims, T > const * >( values( s ) ), static_cast< std::size_t >( s->count ) );
+   }
+
+   /**
+    * release the next batch to the producers; throws quantity_error if there is none.
+    */
+   void pop()
+   {
+      detail::ring_header & h = header();
+
+      std::uint64_t const pos = h.tail.load( std::memory_order_relaxed );
+      detail::ring_slot * const s = slot( pos );
+
+      if ( s->sequence.load( std::memory_order_acquire ) != pos + 1 )
+      {
+         throw quantity_error( "quantity: ring: no batch to pop" );
+      }
+      s->sequence.store( pos + h.slots, std::memory_order_release );
+      h.tail.store( pos + 1, std::memory_order_relaxed );
+   }
+
+private:
+   void map( int const fd )
+   {
+      void * const p = ::mmap( 0, m_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+      ::close( fd );
+
+      if ( p == MAP_FAILED )
+      {
+         if ( m_owner )
+         {
+            ::shm_unlink( m_name.c_str() );
+         }
+         throw quantity_error( "quantity: ring: cannot map '" + m_name + "'" );
+      }
+      m_base = static_cast< char * >( p );
+   }
+
+   detail::ring_header & header() const
+   {
+      return *reinterpret_cast< detail::ring_header * >( m_base );
+   }
+
+   detail::ring_slot * slot( std::uint64_t const pos ) const
+   {
+      detail::ring_header const & h = header();
+
+      return reinterpret_cast< detail::ring_slot * >(
+         m_base + sizeof( detail::ring_header ) + static_cast< std::size_t >( ( pos & ( h.slots - 1 ) ) * h.slot_bytes ) );
+   }
+
+   static char * values( detail::ring_slot * const s )
+   {
+      return reinterpret_cast< char * >( s + 1 );
+   }
+
+   static char const * values( detail::ring_slot const * const s )
+   {
+      return reinterpret_cast< char const * >( s + 1 );
+   }
+
+   /**
+    * claim the slot for the next batch; false if the ring is full.
+    */
+   bool claim( std::uint64_t & pos, detail::ring_slot * & s )
+   {
+      detail::ring_header & h = header();
+
+      pos = h.head.load( std::memory_order_relaxed );
+
+      if ( ! h.multi_producer )
+      {
+         s = slot( pos );
+         if ( s->sequence.load( std::memory_order_acquire ) != pos )
+         {
+            return false;
+         }
+         h.head.store( pos + 1, std::memory_order_relaxed );
+         return true;
+      }
+
+      for ( ;; )
+      {
+         s = slot( pos );
+
+         std::int64_t const diff = static_cast< std::int64_t >( s->sequence.load( std::memory_order_acquire ) - pos );
+
+         if ( diff == 0 )
+         {
+            if ( h.head.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+            {
+               return true;
+            }
+         }
+         else if ( diff < 0 )
+         {
+            return false;
+         }
+         else
+         {
+            pos = h.head.load( std::memory_order_relaxed );
+         }
+      }
+   }
+
+   /**
+    * slot of the next batch, or 0.
+    */
+   detail::ring_slot const * ready() const
+   {
+      std::uint64_t const pos = header().tail.load( std::memory_order_relaxed );
+      detail::ring_slot const * const s = slot( pos );
+
+      return s->sequence.load( std::memory_order_acquire ) == pos + 1 ? s : 0;
+   }
+
+   template< typename Dims, typename T >
+   static bool matches( detail::ring_slot const & s )
+   {
+      int const dim[7] = { Dims::dim1, Dims::dim2, Dims::dim3, Dims::dim4, Dims::dim5, Dims::dim6, Dims::dim7 };
+
+      for ( int d = 0; d < 7; ++d )
+      {
+         if ( s.dim[d] != dim[d] )
+         {
+            return false;
+         }
+      }
+      return s.kind == detail::column_kind<T>::value && s.size == sizeof( T );
+   }
+
+   std::string m_name;
+   bool m_owner;
+   char * m_base;
+   std::size_t m_bytes;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_RING_HPP_INCLUDED
+
+/*
+ * end of file
+ */
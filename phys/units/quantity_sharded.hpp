@@ -0,0 +1,275 @@
+/**
+ * \file quantity_sharded.hpp
+ *
+ * \brief   Sharded accumulator of quantities with one padded shard per thread.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * sharded_accumulator<Dims, T> keeps a partial sum per shard, each on its own
+ * cache line, so that writers never share a line:
+ *
+ *    sharded_accumulator< energy_d > total( workers );
+ *
+ *    total.add( 2.5 * joule() );   // in each worker thread
+ *    ...
+ *    quantity< energy_d > e = total.total();
+ *
+ * add( q ) writes the shard that the calling thread claims when it first adds
+ * to this accumulator; the claim is kept in a small thread_local table keyed
+ * by accumulator. A shard so has one writer and add( q ) is wait-free: a
+ * relaxed load and store, no read-modify-write. Claims last for the lifetime
+ * of the accumulator; threads that come after all shards are claimed, or whose
+ * claim was evicted from the table, add to one extra shared shard with a
+ * compare-and-swap loop, lock-free and without compensation.
+ *
+ * add( q, i ) writes shard i; it is for callers that already have a worker
+ * index, and must not be mixed with add( q ) on the same accumulator.
+ *
+ * total() merges the shards and may run concurrently with add(). With
+ * Compensated = true, shards keep a Kahan compensation term and total()
+ * merges them with compensation.
+ *
+ * This header requires C++11 (std::atomic).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_SHARDED_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_SHARDED_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_sharded.hpp requires C++11 or later
+#endif
+
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uintptr_t, uint64_t
+#include <memory>
+#include <new>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * per-shard partial sums of quantities with dimensions Dims.
+ */
+template< typename Dims, typename T = Rep, bool Compensated = false >
+class sharded_accumulator
+{
+public:
+   typedef quantity< Dims, T > value_type;
+
+   enum { cache_line = 64 };
+
+   /**
+    * accumulator with the given number of shards, all zero; shards >= 1.
+    */
+   explicit sharded_accumulator( std::size_t const shards )
+   : m_storage()
+   , m_shards( 0 )
+   , m_size( shards )
+   , m_id( next_id() )
+   , m_claimed( 0 )
+   {
+      if ( shards < 1 )
+      {
+         throw quantity_error( "quantity: sharded_accumulator: need at least one shard" );
+      }
+
+      m_storage.reset( new char[ ( shards + 1 ) * sizeof( shard ) + cache_line ] );
+
+      std::uintptr_t const p = reinterpret_cast< std::uintptr_t >( m_storage.get() );
+      m_shards = reinterpret_cast< shard * >( ( p + cache_line - 1 ) & ~std::uintptr_t( cache_line - 1 ) );
+
+      for ( std::size_t i = 0; i <= shards; ++i )
+      {
+         new ( m_shards + i ) shard();
+      }
+   }
+
+   sharded_accumulator( sharded_accumulator const & ) = delete;
+   sharded_accumulator & operator=( sharded_accumulator const & ) = delete;
+
+   std::size_t size() const
+   {
+      return m_size;
+   }
+
+   /**
+    * add q to the shard of the calling thread, claimed when it first adds.
+    */
+   void add( value_type const & q ) noexcept
+   {
+      std::size_t const i = claimed_shard();
+
+      if ( i < m_size )
+      {
+         add( q, i );
+      }
+      else
+      {
+         add_shared( q );
+      }
+   }
+
+   /**
+    * add q to shard i; i < size(), one writer per shard at a time.
+    */
+   void add( value_type const & q, std::size_t const i ) noexcept
+   {
+      shard & s = m_shards[i];
+
+      T const sum = s.sum.load( std::memory_order_relaxed );
+
+      if ( Compensated )
+      {
+         T const y = detail::value_of( q ) - s.comp.load( std::memory_order_relaxed );
+         T const t = sum + y;
+
+         s.comp.store( ( t - sum ) - y, std::memory_order_relaxed );
+         s.sum.store( t, std::memory_order_relaxed );
+      }
+      else
+      {
+         s.sum.store( sum + detail::value_of( q ), std::memory_order_relaxed );
+      }
+   }
+
+   /**
+    * partial sum of shard i.
+    */
+   value_type shard_total( std::size_t const i ) const noexcept
+   {
+      return wrap( m_shards[i].sum.load( std::memory_order_relaxed ) );
+   }
+
+   /**
+    * sum over all shards.
+    */
+   value_type total() const noexcept
+   {
+      T sum = T( 0 );
+      T comp = T( 0 );
+
+      for ( std::size_t i = 0; i <= m_size; ++i )
+      {
+         shard const & s = m_shards[i];
+
+         if ( Compensated )
+         {
+            T const y = s.sum.load( std::memory_order_relaxed ) - ( comp + s.comp.load( std::memory_order_relaxed ) );
+            T const t = sum + y;
+
+            comp = ( t - sum ) - y;
+            sum = t;
+         }
+         else
+         {
+            sum += s.sum.load( std::memory_order_relaxed );
+         }
+      }
+      return wrap( sum );
+   }
+
+   /**
+    * set all shards to zero; not concurrently with add().
+    */
+   void reset() noexcept
+   {
+      for ( std::size_t i = 0; i <= m_size; ++i )
+      {
+         m_shards[i].sum.store( T( 0 ), std::memory_order_relaxed );
+         m_shards[i].comp.store( T( 0 ), std::memory_order_relaxed );
+      }
+   }
+
+private:
+   /**
+    * partial sum and compensation, padded to a cache line.
+    */
+   struct shard
+   {
+      shard()
+      : sum( T( 0 ) )
+      , comp( T( 0 ) )
+      {
+      }
+
+      std::atomic<T> sum;
+      std::atomic<T> comp;
+      char pad[ cache_line - 2 * sizeof( std::atomic<T> ) ];
+   };
+
+   /**
+    * shard claimed by the calling thread in accumulator id.
+    */
+   struct claim
+   {
+      std::uint64_t id;
+      std::size_t shard;
+   };
+
+   enum { claims = 16 };
+
+   static std::uint64_t next_id() noexcept
+   {
+      static std::atomic< std::uint64_t > id( 0 );
+
+      return ++id;
+   }
+
+   /**
+    * the calling thread's shard, claimed on first use; size() or more means the shared shard.
+    */
+   std::size_t claimed_shard() noexcept
+   {
+      static thread_local claim table[ claims ] = {};
+
+      claim & c = table[ m_id % claims ];
+
+      if ( c.id != m_id )
+      {
+         c.id = m_id;
+         c.shard = m_claimed.fetch_add( 1, std::memory_order_relaxed );
+      }
+      return c.shard;
+   }
+
+   /**
+    * add q to the shared shard, which has any number of writers.
+    */
+   void add_shared( value_type const & q ) noexcept
+   {
+      std::atomic<T> & sum = m_shards[ m_size ].sum;
+
+      T old = sum.load( std::memory_order_relaxed );
+
+      while ( !sum.compare_exchange_weak( old, old + detail::value_of( q ), std::memory_order_relaxed ) )
+      {
+      }
+   }
+
+   static value_type wrap( T const & v )
+   {
+      return value_type( detail::permit<T>( v ) );
+   }
+
+   std::unique_ptr< char[] > m_storage;
+   shard * m_shards;
+   std::size_t m_size;
+   std::uint64_t m_id;
+   std::atomic< std::size_t > m_claimed;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_SHARDED_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,366 @@
+/**
+ * \file quantity_unit_literal.hpp
+ *
+ * \brief   Compile-time parsing of unit strings to quantity types, "kN*m/s^2"_unit.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * The literal "..."_unit is the unit its string names, as a quantity whose
+ * type and value are computed by the compiler:
+ *
+ *    using namespace phys::units::literals;
+ *
+ *    constexpr auto torque_unit = "kN*m"_unit;             // 1000 m+2 kg s-2
+ *    quantity< force_d > f = 2.5 * "kN"_unit;
+ *    quantity< power_d > p = 3 * "m+2 kg s-3"_unit;        // as emitted by unit_info::symbol()
+ *
+ *    double v = speed / "km/h"_unit;                       // value in km/h
+ *
+ *    typedef unit_dimensions< "W/m^2/K" > heat_transfer_d; // dimensions<0, 1, -3, 0, -1>
+ *
+ * Grammar: terms separated by spaces or '*', or by '/' which divides by the
+ * next term only, so "W/m/K" is W m-1 K-1. A term is a unit symbol with an
+ * optional prefix and an optional integer exponent, written as "^2", "^-1",
+ * "+2", "-3" or "2"; a term "1" allows "1/s". The symbols are those of the
+ * base units, m, g, s, A, K, mol, cd, and of the derived units with a
+ * symbol in the quantity_io_*.hpp headers, Hz, N, Pa, J, W, C, V, F, Ohm,
+ * S, Wb, T, H, lm, lx, Bq, Gy, Sv, rad and sr, and minute, hour and
+ * litre, min, h and L. The prefixes are the SI prefixes, with u for micro.
+ * A symbol is matched before a prefix is tried, so "Pa" is pascal, "h"
+ * hour and "min" minute, while "mm" is millimetre and "hm" hectometre.
+ *
+ * A malformed string or an unknown symbol fails the build. Assigning the
+ * result to a quantity of other dimensions also fails the build.
+ *
+ * This header requires C++20 (class-type non-type template parameters, consteval).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_UNIT_LITERAL_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_UNIT_LITERAL_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#ifndef PHYS_UNITS_CPP20_OR_GREATER
+# error quantity_unit_literal.hpp requires C++20 or later
+#endif
+
+#include <cstddef>  // for size_t
+
+namespace ct { namespace phys { namespace units {
+
+namespace detail {
+
+/**
+ * string literal as a structural type, for use as template argument.
+ */
+template< std::size_t N >
+struct unit_string
+{
+   consteval unit_string( char const ( & s )[N] )
+   {
+      for ( std::size_t i = 0; i < N; ++i )
+      {
+         text[i] = s[i];
+      }
+   }
+
+   constexpr std::size_t size() const
+   {
+      return N - 1;
+   }
+
+   char text[N];
+};
+
+/**
+ * dimensions and factor to coherent SI of a parsed unit.
+ */
+struct parsed_unit
+{
+   int dim[7];
+   long double factor;
+};
+
+/**
+ * a unit symbol, or a prefix if all dimensions are zero.
+ */
+struct unit_entry
+{
+   char const * symbol;
+   int dim[7];
+   long double factor;
+};
+
+inline constexpr unit_entry unit_symbols[] =
+{
+   { "m",   {  1,  0,  0,  0, 0, 0, 0 }, 1.0L  },
+   { "g",   {  0,  1,  0,  0, 0, 0, 0 }, 1e-3L },
+   { "s",   {  0,  0,  1,  0, 0, 0, 0 }, 1.0L  },
+   { "A",   {  0,  0,  0,  1, 0, 0, 0 }, 1.0L  },
+   { "K",   {  0,  0,  0,  0, 1, 0, 0 }, 1.0L  },
+   { "mol", {  0,  0,  0,  0, 0, 1, 0 }, 1.0L  },
+   { "cd",  {  0,  0,  0,  0, 0, 0, 1 }, 1.0L  },
+   { "Hz",  {  0,  0, -1,  0, 0, 0, 0 }, 1.0L  },
+   { "N",   {  1,  1, -2,  0, 0, 0, 0 }, 1.0L  },
+   { "Pa",  { -1,  1, -2,  0, 0, 0, 0 }, 1.0L  },
+   { "J",   {  2,  1, -2,  0, 0, 0, 0 }, 1.0L  },
+   { "W",   {  2,  1, -3,  0, 0, 0, 0 }, 1.0L  },
+   { "C",   {  0,  0,  1,  1, 0, 0, 0 }, 1.0L  },
+   { "V",   {  2,  1, -3, -1, 0, 0, 0 }, 1.0L  },
+   { "F",   { -2, -1,  4,  2, 0, 0, 0 }, 1.0L  },
+   { "Ohm", {  2,  1, -3, -2, 0, 0, 0 }, 1.0L  },
+   { "S",   { -2, -1,  3,  2, 0, 0, 0 }, 1.0L  },
+   { "Wb",  {  2,  1, -2, -1, 0, 0, 0 }, 1.0L  },
+   { "T",   {  0,  1, -2, -1, 0, 0, 0 }, 1.0L  },
+   { "H",   {  2,  1, -2, -2, 0, 0, 0 }, 1.0L  },
+   { "lm",  {  0,  0,  0,  0, 0, 0, 1 }, 1.0L  },
+   { "lx",  { -2,  0,  0,  0, 0, 0, 1 }, 1.0L  },
+   { "Bq",  {  0,  0, -1,  0, 0, 0, 0 }, 1.0L  },
+   { "Gy",  {  2,  0, -2,  0, 0, 0, 0 }, 1.0L  },
+   { "Sv",  {  2,  0, -2,  0, 0, 0, 0 }, 1.0L  },
+   { "rad", {  0,  0,  0,  0, 0, 0, 0 }, 1.0L  },
+   { "sr",  {  0,  0,  0,  0, 0, 0, 0 }, 1.0L  },
+   { "min", {  0,  0,  1,  0, 0, 0, 0 }, 60.0L },
+   { "h",   {  0,  0,  1,  0, 0, 0, 0 }, 3600.0L },
+   { "L",   {  3,  0,  0,  0, 0, 0, 0 }, 1e-3L },
+};
+
+inline constexpr unit_entry unit_prefixes[] =
+{
+   { "da", {}, 1e+1L  },
+   { "Y",  {}, 1e+24L }, { "Z", {}, 1e+21L }, { "E", {}, 1e+18L }, { "P", {}, 1e+15L },
+   { "T",  {}, 1e+12L }, { "G", {}, 1e+9L  }, { "M", {}, 1e+6L  }, { "k", {}, 1e+3L  },
+   { "h",  {}, 1e+2L  }, { "d", {}, 1e-1L  }, { "c", {}, 1e-2L  }, { "m", {}, 1e-3L  },
+   { "u",  {}, 1e-6L  }, { "n", {}, 1e-9L  }, { "p", {}, 1e-12L }, { "f", {}, 1e-15L },
+   { "a",  {}, 1e-18L }, { "z", {}, 1e-21L }, { "y", {}, 1e-24L },
+};
+
+/**
+ * true if s[0..n) equals the null-terminated text.
+ */
+constexpr bool unit_equal( char const * s, std::size_t n, char const * text )
+{
+   std::size_t i = 0;
+   for ( ; i < n; ++i )
+   {
+      if ( text[i] != s[i] )
+      {
+         return false;
+      }
+   }
+   return text[i] == '\0';
+}
+
+/**
+ * length of the null-terminated text.
+ */
+constexpr std::size_t unit_length( char const * text )
+{
+   std::size_t n = 0;
+   while ( text[n] )
+   {
+      ++n;
+   }
+   return n;
+}
+
+/**
+ * entry of the unit symbol s[0..n), or null.
+ */
+constexpr unit_entry const * find_unit_symbol( char const * s, std::size_t n )
+{
+   for ( unit_entry const & e : unit_symbols )
+   {
+      if ( unit_equal( s, n, e.symbol ) )
+      {
+         return &e;
+      }
+   }
+   return nullptr;
+}
+
+/**
+ * dimensions and factor of the prefixed unit symbol s[0..n).
+ */
+constexpr parsed_unit parse_unit_word( char const * s, std::size_t n )
+{
+   if ( unit_entry const * e = find_unit_symbol( s, n ) )
+   {
+      return parsed_unit{ { e->dim[0], e->dim[1], e->dim[2], e->dim[3], e->dim[4], e->dim[5], e->dim[6] }, e->factor };
+   }
+
+   for ( unit_entry const & p : unit_prefixes )
+   {
+      std::size_t const k = unit_length( p.symbol );
+
+      if ( k < n && unit_equal( s, k, p.symbol ) )
+      {
+         if ( unit_entry const * e = find_unit_symbol( s + k, n - k ) )
+         {
+            return parsed_unit{ { e->dim[0], e->dim[1], e->dim[2], e->dim[3], e->dim[4], e->dim[5], e->dim[6] }, p.factor * e->factor };
+         }
+      }
+   }
+   throw quantity_error( "quantity: unit: unknown unit symbol" );
+}
+
+constexpr bool unit_letter( char const c )
+{
+   return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' );
+}
+
+constexpr bool unit_digit( char const c )
+{
+   return c >= '0' && c <= '9';
+}
+
+/**
+ * dimensions and factor of the unit named by s[0..n); throws quantity_error if malformed.
+ */
+constexpr parsed_unit parse_unit( char const * s, std::size_t const n )
+{
+   parsed_unit result = { { 0, 0, 0, 0, 0, 0, 0 }, 1.0L };
+
+   std::size_t i = 0;
+   int sign = 1;
+   bool term = false;   // a term was read since the last separator
+
+   while ( i < n )
+   {
+      char const c = s[i];
+
+      if ( c == ' ' )
+      {
+         ++i;
+         continue;
+      }
+      if ( c == '*' || c == '/' )
+      {
+         if ( ! term )
+         {
+            throw quantity_error( "quantity: unit: missing term before '*' or '/'" );
+         }
+         sign = c == '/' ? -1 : 1;
+         term = false;
+         ++i;
+         continue;
+      }
+      if ( c == '1' && ( i + 1 == n || ! unit_digit( s[i + 1] ) ) )
+      {
+         sign = 1;
+         term = true;
+         ++i;
+         continue;
+      }
+      if ( ! unit_letter( c ) )
+      {
+         throw quantity_error( "quantity: unit: expected a unit symbol" );
+      }
+
+      std::size_t const begin = i;
+      while ( i < n && unit_letter( s[i] ) )
+      {
+         ++i;
+      }
+      parsed_unit const unit = parse_unit_word( s + begin, i - begin );
+
+      // optional exponent: ^n, ^+n, ^-n, +n, -n or n
+
+      bool const caret = i < n && s[i] == '^';
+      if ( caret )
+      {
+         ++i;
+      }
+      int exp_sign = 1;
+      if ( i < n && ( s[i] == '+' || s[i] == '-' ) )
+      {
+         exp_sign = s[i] == '-' ? -1 : 1;
+         ++i;
+         if ( i == n || ! unit_digit( s[i] ) )
+         {
+            throw quantity_error( "quantity: unit: expected exponent digits" );
+         }
+      }
+      int exponent = 1;
+      if ( i < n && unit_digit( s[i] ) )
+      {
+         exponent = 0;
+         while ( i < n && unit_digit( s[i] ) )
+         {
+            exponent = 10 * exponent + ( s[i] - '0' );
+            ++i;
+         }
+      }
+      else if ( caret )
+      {
+         throw quantity_error( "quantity: unit: expected exponent after '^'" );
+      }
+      exponent *= exp_sign * sign;
+
+      for ( int d = 0; d < 7; ++d )
+      {
+         result.dim[d] += exponent * unit.dim[d];
+      }
+      for ( int k = 0; k < ( exponent < 0 ? -exponent : exponent ); ++k )
+      {
+         result.factor = exponent < 0 ? result.factor / unit.factor : result.factor * unit.factor;
+      }
+
+      sign = 1;
+      term = true;
+   }
+
+   if ( ! term )
+   {
+      throw quantity_error( "quantity: unit: missing term" );
+   }
+   return result;
+}
+
+/**
+ * dimensions, type and value of the unit named by S.
+ */
+template< unit_string S >
+struct unit_traits
+{
+   static constexpr parsed_unit unit = parse_unit( S.text, S.size() );
+
+   typedef dimensions< unit.dim[0], unit.dim[1], unit.dim[2], unit.dim[3], unit.dim[4], unit.dim[5], unit.dim[6] > dimension_type;
+
+   typedef typename collapse< dimension_type, Rep >::type type;
+};
+
+} // namespace detail
+
+/**
+ * dimensions of the unit named by S.
+ */
+template< detail::unit_string S >
+using unit_dimensions = typename detail::unit_traits<S>::dimension_type;
+
+namespace literals {
+
+/**
+ * the unit named by the string, as a quantity computed at compile time.
+ */
+template< detail::unit_string S >
+consteval typename detail::unit_traits<S>::type operator""_unit()
+{
+   return typename detail::unit_traits<S>::type( detail::permit<Rep>( static_cast<Rep>( detail::unit_traits<S>::unit.factor ) ) );
+}
+
+} // namespace literals
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_UNIT_LITERAL_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,536 @@
+/**
+ * \file quantity_unit_parser.hpp
+ *
+ * \brief   Runtime parsing of unit expressions, with a memoising cache.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * parse_unit_expression() turns a unit string as found in incoming data
+ * into its dimensions, as a dimension_code, and its factor to coherent SI:
+ *
+ *    unit_expression u = parse_unit_expression( "kW.h" );   // 3.6e6 m+2 kg s-2
+ *
+ *    if ( has_dimensions< energy_d >( u ) ) ...
+ *
+ *    quantity< energy_d > e = make_quantity< energy_d >( 12.5, u );
+ *
+ * The grammar is that of "..."_unit in quantity_unit_literal.hpp, with '.'
+ * as an additional multiplication: terms separated by spaces, '*' or '.',
+ * or by '/' which divides by the next term only; a term is a symbol with
+ * an optional prefix and integer exponent, as in "m3/s", "N m", "s^-1",
+ * "m+2 kg s-3", or "1". Prefixes are those of prefix(), with the micro
+ * sign accepted for u. Symbols are the base units, with g for mass, the
+ * derived units with a symbol in the quantity_io_*.hpp headers, and the
+ * units of quantity.hpp and other_units.hpp with a customary symbol: min,
+ * h, d, L, t, bar, ha, Wh, atm, Torr, psi, in, ft, yd, mi, lb and hp. An exact symbol is matched
+ * before a prefix is tried, so "Pa" is pascal and "h" hour.
+ *
+ * Parsing takes a few hundred nanoseconds and allocates. unit_expression_cache
+ * memoises the results for strings seen before:
+ *
+ *    unit_expression_cache cache;          // shared by all ingest threads
+ *    ...
+ *    unit_expression u = cache.lookup( record.unit );
+ *
+ * The cache is an open-addressing hash table of immutable entries. A lookup
+ * is lock-free: a hash of the string and atomic loads along the probe
+ * sequence. A miss parses the string and publishes the entry by
+ * compare-and-swap, so lookups never block one another. Entries are kept
+ * until the cache is destroyed. At three quarters of the capacity, new
+ * strings are parsed but no longer stored.
+ *
+ * Malformed strings and unknown symbols throw quantity_error, also from
+ * lookup(); they are not cached.
+ *
+ * This header requires C++11 (std::atomic).
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_UNIT_PARSER_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_UNIT_PARSER_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+#include "phys/units/other_units.hpp"
+
+#ifndef PHYS_UNITS_CPP11_OR_GREATER
+# error quantity_unit_parser.hpp requires C++11 or later
+#endif
+
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <cstring>  // for memcmp
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * dimensions, as dimension_code, and factor to coherent SI of a unit expression.
+ */
+struct unit_expression
+{
+   long long code;
+   Rep factor;
+};
+
+namespace detail {
+
+/**
+ * a unit symbol with its dimension exponents and factor.
+ */
+struct unit_symbol_entry
+{
+   std::string symbol;
+   int dim[7];
+   Rep factor;
+};
+
+inline unit_symbol_entry make_unit_symbol( std::string const & symbol, Rep const factor )
+{
+   unit_symbol_entry const s = { symbol, { 0, 0, 0, 0, 0, 0, 0 }, factor };
+   return s;
+}
+
+template< typename Dims, typename T >
+unit_symbol_entry make_unit_symbol( std::string const & symbol, quantity< Dims, T > const & unit )
+{
+   unit_symbol_entry const s = { symbol,
+      { Dims::dim1, Dims::dim2, Dims::dim3, Dims::dim4, Dims::dim5, Dims::dim6, Dims::dim7 }, value_of( unit ) };
+   return s;
+}
+
+/**
+ * the known unit symbols, built on first use.
+ */
+inline std::vector< unit_symbol_entry > const & unit_symbol_table()
+{
+   static std::vector< unit_symbol_entry > const table =
+   {
+      // base units; the prefixes of mass apply to the gram
+
+      make_unit_symbol( "m",   meter() ),
+      make_unit_symbol( "g",   Rep( 1e-3L ) * kilogram() ),
+      make_unit_symbol( "s",   second() ),
+      make_unit_symbol( "A",   ampere() ),
+      make_unit_symbol( "K",   kelvin() ),
+      make_unit_symbol( "mol", mole() ),
+      make_unit_symbol( "cd",  candela() ),
+
+      // derived units with a symbol, as in the quantity_io_*.hpp headers
+
+      make_unit_symbol( "Hz",  hertz() ),
+      make_unit_symbol( "N",   newton() ),
+      make_unit_symbol( "Pa",  pascal() ),
+      make_unit_symbol( "J",   joule() ),
+      make_unit_symbol( "W",   watt() ),
+      make_unit_symbol( "C",   coulomb() ),
+      make_unit_symbol( "V",   volt() ),
+      make_unit_symbol( "F",   farad() ),
+      make_unit_symbol( "Ohm", ohm() ),
+      make_unit_symbol( "S",   siemens() ),
+      make_unit_symbol( "Wb",  weber() ),
+      make_unit_symbol( "T",   tesla() ),
+      make_unit_symbol( "H",   henry() ),
+      make_unit_symbol( "lx",  lux() ),
+      make_unit_symbol( "Sv",  sievert() ),
+      make_unit_symbol( "Bq",  becquerel() ),
+      make_unit_symbol( "Gy",  gray() ),
+      make_unit_symbol( "lm",  lumen() ),
+      make_unit_symbol( "rad", Rep( 1 ) ),
+      make_unit_symbol( "sr",  Rep( 1 ) ),
+
+      // units approved for use with SI and customary units
+
+      make_unit_symbol( "min", minute() ),
+      make_unit_symbol( "h",   hour() ),
+      make_unit_symbol( "d",   day() ),
+      make_unit_symbol( "L",   liter() ),
+      make_unit_symbol( "t",   ton_metric() ),
+      make_unit_symbol( "bar", bar() ),
+      make_unit_symbol( "ha",  hectare() ),
+      make_unit_symbol( "Wh",  watt() * hour() ),
+      make_unit_symbol( "atm", atmosphere_std() ),
+      make_unit_symbol( "Torr", torr() ),
+      make_unit_symbol( "psi", psi() ),
+      make_unit_symbol( "in",  inch() ),
+      make_unit_symbol( "ft",  foot() ),
+      make_unit_symbol( "yd",  yard() ),
+      make_unit_symbol( "mi",  mile() ),
+      make_unit_symbol( "lb",  pound_avdp() ),
+      make_unit_symbol( "hp",  horsepower() ),
+   };
+   return table;
+}
+
+inline unit_symbol_entry const * lookup_unit_symbol( std::string const & symbol )
+{
+   std::vector< unit_symbol_entry > const & table = unit_symbol_table();
+
+   for ( std::size_t i = 0; i < table.size(); ++i )
+   {
+      if ( table[i].symbol == symbol )
+      {
+         return &table[i];
+      }
+   }
+   return 0;
+}
+
+/**
+ * the prefixed unit symbol word, with its factor in factor.
+ */
+inline unit_symbol_entry const & parse_prefixed_symbol( std::string word, Rep & factor )
+{
+   // micro sign and greek mu, in UTF-8
+
+   if ( word.compare( 0, 2, "\xC2\xB5" ) == 0 || word.compare( 0, 2, "\xCE\xBC" ) == 0 )
+   {
+      word.replace( 0, 2, "u" );
+   }
+
+   factor = 1;
+
+   if ( unit_symbol_entry const * s = lookup_unit_symbol( word ) )
+   {
+      return *s;
+   }
+
+   for ( std::size_t k = 1; k <= 2 && k < word.size(); ++k )
+   {
+      if ( unit_symbol_entry const * s = lookup_unit_symbol( word.substr( k ) ) )
+      {
+         factor = prefix( word.substr( 0, k ) );
+         return *s;
+      }
+   }
+   throw quantity_error( "quantity: unit: unknown unit symbol '" + word + "'" );
+}
+
+inline bool is_unit_letter( char const c )
+{
+   return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c & 0x80 );
+}
+
+inline bool is_unit_digit( char const c )
+{
+   return c >= '0' && c <= '9';
+}
+
+/**
+ * FNV-1a hash of text[0..length).
+ */
+inline std::uint64_t unit_hash( char const * const text, std::size_t const length )
+{
+   std::uint64_t h = 14695981039346656037ULL;
+
+   for ( std::size_t i = 0; i < length; ++i )
+   {
+      h = ( h ^ static_cast< unsigned char >( text[i] ) ) * 1099511628211ULL;
+   }
+   return h;
+}
+
+} // namespace detail
+
+/**
+ * dimensions and factor of the unit expression text[0..length); throws quantity_error if malformed.
+ */
+inline unit_expression parse_unit_expression( char const * const s, std::size_t const n )
+{
+   int dim[7] = { 0, 0, 0, 0, 0, 0, 0 };
+   Rep factor = 1;
+
+   std::size_t i = 0;
+   int sign = 1;
+   bool term = false;   // a term was read since the last separator
+
+   while ( i < n )
+   {
+      char const c = s[i];
+
+      if ( c == ' ' )
+      {
+         ++i;
+         continue;
+      }
+      if ( c == '*' || c == '.' || c == '/' )
+      {
+         if ( ! term )
+         {
+            throw quantity_error( "quantity: unit: missing term before '" + std::string( 1, c ) + "'" );
+         }
+         sign = c == '/' ? -1 : 1;
+         term = false;
+         ++i;
+         continue;
+      }
+      if ( c == '1' && ( i + 1 == n || ! detail::is_unit_digit( s[i + 1] ) ) )
+      {
+         sign = 1;
+         term = true;
+         ++i;
+         continue;
+      }
+      if ( ! detail::is_unit_letter( c ) )
+      {
+         throw quantity_error( "quantity: unit: expected a unit symbol at '" + std::string( s + i, n - i ) + "'" );
+      }
+
+      std::size_t const begin = i;
+      while ( i < n && detail::is_unit_letter( s[i] ) )
+      {
+         ++i;
+      }
+      Rep prefix_factor = 1;
+      detail::unit_symbol_entry const & unit = detail::parse_prefixed_symbol( std::string( s + begin, i - begin ), prefix_factor );
+
+      // optional exponent: ^n, ^+n, ^-n, +n, -n or n
+
+      bool const caret = i < n && s[i] == '^';
+      if ( caret )
+      {
+         ++i;
+      }
+      int exp_sign = 1;
+      if ( i < n && ( s[i] == '+' || s[i] == '-' ) )
+      {
+         exp_sign = s[i] == '-' ? -1 : 1;
+         ++i;
+         if ( i == n || ! detail::is_unit_digit( s[i] ) )
+         {
+            throw quantity_error( "quantity: unit: expected exponent digits" );
+         }
+      }
+      int exponent = 1;
+      if ( i < n && detail::is_unit_digit( s[i] ) )
+      {
+         exponent = 0;
+         while ( i < n && detail::is_unit_digit( s[i] ) && exponent < 100 )
+         {
+            exponent = 10 * exponent + ( s[i] - '0' );
+            ++i;
+         }
+      }
+      else if ( caret )
+      {
+         throw quantity_error( "quantity: unit: expected exponent after '^'" );
+      }
+      exponent *= exp_sign * sign;
+
+      for ( int d = 0; d < 7; ++d )
+      {
+         dim[d] += exponent * unit.dim[d];
+      }
+      Rep const term_factor = prefix_factor * unit.factor;
+      for ( int k = 0; k < ( exponent < 0 ? -exponent : exponent ); ++k )
+      {
+         factor = exponent < 0 ? factor / term_factor : factor * term_factor;
+      }
+
+      sign = 1;
+      term = true;
+   }
+
+   if ( ! term )
+   {
+      throw quantity_error( "quantity: unit: missing term" );
+   }
+
+   long long code = 0;
+   for ( int d = 6; d >= 0; --d )
+   {
+      if ( dim[d] < -128 || dim[d] > 127 )
+      {
+         throw quantity_error( "quantity: unit: dimension exponent out of range" );
+      }
+      code = 256 * code + dim[d];
+   }
+
+   unit_expression const result = { code, factor };
+   return result;
+}
+
+/**
+ * dimensions and factor of the unit expression text; throws quantity_error if malformed.
+ */
+inline unit_expression parse_unit_expression( std::string const & text )
+{
+   return parse_unit_expression( text.data(), text.size() );
+}
+
+/**
+ * true if unit expression u has dimensions Dims.
+ */
+template< typename Dims >
+inline bool has_dimensions( unit_expression const & u )
+{
+   return u.code == dimension_code< Dims >::value;
+}
+
+/**
+ * quantity of value in unit expression u; throws quantity_error if u does not have dimensions Dims.
+ */
+template< typename Dims >
+inline quantity< Dims > make_quantity( Rep const value, unit_expression const & u )
+{
+   if ( ! has_dimensions< Dims >( u ) )
+   {
+      throw quantity_error( "quantity: unit: dimensions of unit expression do not match" );
+   }
+   return quantity< Dims >( detail::permit<Rep>( value * u.factor ) );
+}
+
+/**
+ * thread-safe memoising cache of parsed unit expressions.
+ */
+class unit_expression_cache
+{
+public:
+   /**
+    * cache for at most three quarters of capacity strings; capacity is rounded up to a power of two.
+    */
+   explicit unit_expression_cache( std::size_t const capacity = 1024 )
+   : m_slots()
+   , m_mask( 0 )
+   , m_limit( 0 )
+   , m_size( 0 )
+   {
+      std::size_t n = 16;
+      while ( n < capacity )
+      {
+         n *= 2;
+      }
+      m_slots.reset( new std::atomic< entry * >[ n ] );
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+         m_slots[i].store( 0, std::memory_order_relaxed );
+      }
+      m_mask = n - 1;
+      m_limit = n - n / 4;
+   }
+
+   ~unit_expression_cache()
+   {
+      for ( std::size_t i = 0; i <= m_mask; ++i )
+      {
+         delete m_slots[i].load( std::memory_order_relaxed );
+      }
+   }
+
+   unit_expression_cache( unit_expression_cache const & ) = delete;
+   unit_expression_cache & operator=( unit_expression_cache const & ) = delete;
+
+   /**
+    * number of cached strings, including those being inserted.
+    */
+   std::size_t size() const
+   {
+      return m_size.load( std::memory_order_relaxed );
+   }
+
+   /**
+    * dimensions and factor of unit expression text[0..length), parsed on first use.
+    */
+   unit_expression lookup( char const * const text, std::size_t const length )
+   {
+      std::uint64_t const hash = detail::unit_hash( text, length );
+
+      std::size_t i = static_cast< std::size_t >( hash ) & m_mask;
+
+      for ( ;; i = ( i + 1 ) & m_mask )
+      {
+         entry const * const e = m_slots[i].load( std::memory_order_acquire );
+
+         if ( ! e )
+         {
+            return insert( i, hash, text, length );
+         }
+         if ( e->matches( hash, text, length ) )
+         {
+            return e->unit;
+         }
+      }
+   }
+
+   /**
+    * dimensions and factor of unit expression text, parsed on first use.
+    */
+   unit_expression lookup( std::string const & text )
+   {
+      return lookup( text.data(), text.size() );
+   }
+
+private:
+   /**
+    * an immutable cached string and its parse.
+    */
+   struct entry
+   {
+      bool matches( std::uint64_t const h, char const * const s, std::size_t const n ) const
+      {
+         return hash == h && text.size() == n && std::memcmp( text.data(), s, n ) == 0;
+      }
+
+      std::uint64_t hash;
+      std::string text;
+      unit_expression unit;
+   };
+
+   /**
+    * parse text and publish it at the first free slot from i on.
+    */
+   unit_expression insert( std::size_t i, std::uint64_t const hash, char const * const text, std::size_t const length )
+   {
+      unit_expression const unit = parse_unit_expression( text, length );
+
+      std::unique_ptr< entry > fresh( new entry() );
+      fresh->hash = hash;
+      fresh->text.assign( text, length );
+      fresh->unit = unit;
+
+      // reserve a slot before publishing, so that concurrent inserts cannot
+      // fill the table past the limit and a free slot always ends a probe
+
+      if ( m_size.fetch_add( 1, std::memory_order_relaxed ) >= m_limit )
+      {
+         m_size.fetch_sub( 1, std::memory_order_relaxed );
+         return unit;
+      }
+
+      for ( ;; i = ( i + 1 ) & m_mask )
+      {
+         entry * e = 0;
+
+         if ( m_slots[i].compare_exchange_strong( e, fresh.get(), std::memory_order_acq_rel, std::memory_order_acquire ) )
+         {
+            fresh.release();
+            return unit;
+         }
+         if ( e->matches( hash, text, length ) )
+         {
+            m_size.fetch_sub( 1, std::memory_order_relaxed );
+            return e->unit;
+         }
+      }
+   }
+
+   std::unique_ptr< std::atomic< entry * >[] > m_slots;
+   std::size_t m_mask;
+   std::size_t m_limit;
+   std::atomic< std::size_t > m_size;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_UNIT_PARSER_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,516 @@
+/**
+ * \file quantity_vector.hpp
+ *
+ * \brief   Fixed-size vectors of quantities, e.g. position, velocity and force.
+ * \date    18 October 2026
+ * \since   1.1
+ *
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * quantity_vector< Dims, T, N > stores N values of type T that share the
+ * dimensions Dims. The dot product and cross product obtain their
+ * dimensions via detail::product<>, so e.g. a position vector crossed with
+ * a force vector yields a torque vector.
+ *
+ * quantity_vector_array< Dims, T, N > stores many such vectors as N
+ * separate contiguous component arrays (structure of arrays). Its bulk
+ * operations are plain loops over these arrays that compilers vectorize
+ * for the target instruction set (SSE, AVX, NEON) without intrinsics.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_VECTOR_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_VECTOR_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"   // for quantity_error
+
+#include <cmath>    // for sqrt()
+#include <cstddef>  // for size_t
+#include <vector>
+
+namespace ct { namespace phys { namespace units {
+
+/**
+ * vector of N quantities of the same dimensions.
+ */
+template< typename Dims, typename T = Rep, int N = 3 >
+class quantity_vector
+{
+public:
+   typedef Dims dimension_type;
+
+   typedef T value_type;
+
+   typedef TYPENAME_TYPE_K detail::collapse< Dims, T >::type element_type;
+
+   typedef quantity_vector< Dims, T, N > this_type;
+
+   enum { size = N };
+
+   /**
+    * uninitialized vector, like quantity.
+    */
+   quantity_vector()
+   {
+   }
+
+   /**
+    * two-element vector.
+    */
+   quantity_vector( element_type const & x, element_type const & y )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( N == 2, "vector must have two elements" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( N == 2, vector_must_have_two_elements );
+      (void) sizeof( ERROR__vector_must_have_two_elements );
+#endif
+
+      m_value[0] = detail::value_of( x );
+      m_value[1] = detail::value_of( y );
+   }
+
+   /**
+    * three-element vector.
+    */
+   quantity_vector( element_type const & x, element_type const & y, element_type const & z )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert( N == 3, "vector must have three elements" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE( N == 3, vector_must_have_three_elements );
+      (void) sizeof( ERROR__vector_must_have_three_elements );
+#endif
+
+      m_value[0] = detail::value_of( x );
+      m_value[1] = detail::value_of( y );
+      m_value[2] = detail::value_of( z );
+   }
+
+   /**
+    * the null vector.
+    */
+   static quantity_vector zero()
+   {
+      quantity_vector result;
+
+      for ( int i = 0; i < N; ++i )
+      {
+         result.m_value[i] = value_type( 0 );
+      }
+      return result;
+   }
+
+   /**
+    * i-th element.
+    */
+   element_type operator[]( int const i ) const
+   {
+      return detail::from_value< Dims, T >( m_value[i] );
+   }
+
+   /**
+    * set i-th element.
+    */
+   void set( int const i, element_type const & q )
+   {
+      m_value[i] = detail::value_of( q );
+   }
+
+   this_type & operator+=( this_type const & rhs )
+   {
+      for ( int i = 0; i < N; ++i )
+      {
+         m_value[i] += rhs.m_value[i];
+      }
+      return *this;
+   }
+
+   this_type & operator-=( this_type const & rhs )
+   {
+      for ( int i = 0; i < N; ++i )
+      {
+         m_value[i] -= rhs.m_value[i];
+      }
+      return *this;
+   }
+
+   this_type & operator*=( Rep const & rhs )
+   {
+      for ( int i = 0; i < N; ++i )
+      {
+         m_value[i] *= rhs;
+      }
+      return *this;
+   }
+
+   this_type & operator/=( Rep const & rhs )
+   {
+      for ( int i = 0; i < N; ++i )
+      {
+         m_value[i] /= rhs;
+      }
+      return *this;
+   }
+
+   /**
+    * permit access to the values (non-const).
+    */
+   value_type * data( detail::permit< value_type > const & )
+   {
+      return m_value;
+   }
+
+   /**
+    * permit access to the values (const).
+    */
+   value_type const * data( detail::permit< value_type > const & ) const
+   {
+      return m_value;
+   }
+
+private:
+   value_type m_value[N];
+};
+
+namespace detail {
+
+/**
+ * vector of dimensions Dims, from the values of a vector of any dimensions.
+ */
+template< typename Dims, typename T, int N, typename RhsDims >
+inline quantity_vector< Dims, T, N >
+retype( quantity_vector< RhsDims, T, N > const & v, T const & factor )
+{
+   quantity_vector< Dims, T, N > result;
+
+   T       * r = result.data( permit<T>() );
+   T const * a = v.data( permit<T>() );
+
+   for ( int i = 0; i < N; ++i )
+   {
+      r[i] = factor * a[i];
+   }
+   return result;
+}
+
+} // namespace detail
+
+/**
+ * + vec
+ */
+template< typename Dims, typename T, int N >
+inline quantity_vector< Dims, T, N >
+operator+( quantity_vector< Dims, T, N > const & rhs )
+{
+   return rhs;
+}
+
+/**
+ * vec + vec
+ */
+template< typename Dims, typename T, int N >
+inline quantity_vector< Dims, T, N >
+operator+( quantity_vector< Dims, T, N > const & lhs, quantity_vector< Dims, T, N > const & rhs )
+{
+   quantity_vector< Dims, T, N > result( lhs );
+   return result += rhs;
+}
+
+/**
+ * - vec
+ */
+template< typename Dims, typename T, int N >
+inline quantity_vector< Dims, T, N >
+operator-( quantity_vector< Dims, T, N > const & rhs )
+{
+   return detail::retype< Dims >( rhs, T( -1 ) );
+}
+
+/**
+ * vec - vec
+ */
+template< typename Dims, typename T, int N >
+inline quantity_vector< Dims, T, N >
+operator-( quantity_vector< Dims, T, N > const & lhs, quantity_vector< Dims, T, N > const & rhs )
+{
+   quantity_vector< Dims, T, N > result( lhs );
+   return result -= rhs;
+}
+
+/**
+ * vec * num
+ */
+template< typename Dims, typename T, int N >
+inline quantity_vector< Dims, T, N >
+operator*( quantity_vector< Dims, T, N > const & lhs, Rep const & rhs )
+{
+   return detail::retype< Dims >( lhs, T( rhs ) );
+}
+
+/**
+ * num * vec
+ */
+template< typename Dims, typename T, int N >
+inline quantity_vector< Dims, T, N >
+operator*( Rep const & lhs, quantity_vector< Dims, T, N > const & rhs )
+{
+   return detail::retype< Dims >( rhs, T( lhs ) );
+}
+
+/**
+ * vec / num
+ */
+template< typename Dims, typename T, int N >
+inline quantity_vector< Dims, T, N >
+operator/( quantity_vector< Dims, T, N > const & lhs, Rep const & rhs )
+{
+   return detail::retype< Dims >( lhs, T( 1 ) / T( rhs ) );
+}
+
+/**
+ * vec * quan
+ */
+template< typename Dims, typename T, int N, typename RhsDims, typename Y >
+inline quantity_vector< TYPENAME_TYPE_K detail::product< Dims, RhsDims, T >::dimension_type, T, N >
+operator*( quantity_vector< Dims, T, N > const & lhs, quantity< RhsDims, Y > const & rhs )
+{
+   return detail::retype< TYPENAME_TYPE_K detail::product< Dims, RhsDims, T >::dimension_type >(
+      lhs, T( rhs.get( detail::permit<Y>() ) ) );
+}
+
+/**
+ * quan * vec
+ */
+template< typename LhsDims, typename X, typename Dims, typename T, int N >
+inline quantity_vector< TYPENAME_TYPE_K detail::product< LhsDims, Dims, T >::dimension_type, T, N >
+operator*( quantity< LhsDims, X > const & lhs, quantity_vector< Dims, T, N > const & rhs )
+{
+   return detail::retype< TYPENAME_TYPE_K detail::product< LhsDims, Dims, T >::dimension_type >(
+      rhs, T( lhs.get( detail::permit<X>() ) ) );
+}
+
+/**
+ * vec / quan
+ */
+template< typename Dims, typename T, int N, typename RhsDims, typename Y >
+inline quantity_vector< TYPENAME_TYPE_K detail::quotient< Dims, RhsDims, T >::dimension_type, T, N >
+operator/( quantity_vector< Dims, T, N > const & lhs, quantity< RhsDims, Y > const & rhs )
+{
+   return detail::retype< TYPENAME_TYPE_K detail::quotient< Dims, RhsDims, T >::dimension_type >(
+      lhs, T( 1 ) / T( rhs.get( detail::permit<Y>() ) ) );
+}
+
+/**
+ * equality.
+ */
+template< typename Dims, typename T, int N >
+inline bool operator==( quantity_vector< Dims, T, N > const & lhs, quantity_vector< Dims, T, N > const & rhs )
+{
+   T const * a = lhs.data( detail::permit<T>() );
+   T const * b = rhs.data( detail::permit<T>() );
+
+   for ( int i = 0; i < N; ++i )
+   {
+      if ( a[i] != b[i] )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+/**
+ * inequality.
+ */
+template< typename Dims, typename T, int N >
+inline bool operator!=( quantity_vector< Dims, T, N > const & lhs, quantity_vector< Dims, T, N > const & rhs )
+{
+   return !( lhs == rhs );
+}
+
+/**
+ * dot product, e.g. force . displacement yields energy.
+ */
+template< typename LhsDims, typename RhsDims, typename T, int N >
+inline typename detail::product< LhsDims, RhsDims, T >::type
+dot( quantity_vector< LhsDims, T, N > const & lhs, quantity_vector< RhsDims, T, N > const & rhs )
+{
+   T const * a = lhs.data( detail::permit<T>() );
+   T const * b = rhs.data( detail::permit<T>() );
+
+   T sum( 0 );
+
+   for ( int i = 0; i < N; ++i )
+   {
+      sum += a[i] * b[i];
+   }
+   return detail::from_value< TYPENAME_TYPE_K detail::product< LhsDims, RhsDims, T >::dimension_type, T >( sum );
+}
+
+/**
+ * cross product, e.g. position x force yields torque.
+ */
+template< typename LhsDims, typename RhsDims, typename T >
+inline quantity_vector< TYPENAME_TYPE_K detail::product< LhsDims, RhsDims, T >::dimension_type, T, 3 >
+cross( quantity_vector< LhsDims, T, 3 > const & lhs, quantity_vector< RhsDims, T, 3 > const & rhs )
+{
+   quantity_vector< TYPENAME_TYPE_K detail::product< LhsDims, RhsDims, T >::dimension_type, T, 3 > result;
+
+   T       * r = result.data( detail::permit<T>() );
+   T const * a = lhs.data( detail::permit<T>() );
+   T const * b = rhs.data( detail::permit<T>() );
+
+   r[0] = a[1] * b[2] - a[2] * b[1];
+   r[1] = a[2] * b[0] - a[0] * b[2];
+   r[2] = a[0] * b[1] - a[1] * b[0];
+
+   return result;
+}
+
+/**
+ * Euclidean length, with the dimensions of the elements.
+ */
+template< typename Dims, typename T, int N >
+inline typename quantity_vector< Dims, T, N >::element_type
+norm( quantity_vector< Dims, T, N > const & v )
+{
+   T const * a = v.data( detail::permit<T>() );
+
+   T sum( 0 );
+
+   for ( int i = 0; i < N; ++i )
+   {
+      sum += a[i] * a[i];
+   }
+   return detail::from_value< Dims, T >( T( std::sqrt( sum ) ) );
+}
+
+/**
+ * many vectors of N quantities, stored as N contiguous component arrays.
+ */
+template< typename Dims, typename T = Rep, int N = 3 >
+class quantity_vector_array
+{
+public:
+   typedef Dims dimension_type;
+
+   typedef T value_type;
+
+   typedef quantity_vector< Dims, T, N > vector_type;
+
+   typedef quantity_vector_array< Dims, T, N > this_type;
+
+   typedef std::size_t size_type;
+
+   /**
+    * array of n null vectors.
+    */
+   explicit quantity_vector_array( size_type const n = 0 )
+   : m_size( n )
+   , m_value( N * n, value_type( 0 ) )
+   {
+   }
+
+   size_type size() const
+   {
+      return m_size;
+   }
+
+   /**
+    * i-th vector.
+    */
+   vector_type operator[]( size_type const i ) const
+   {
+      vector_type result;
+      value_type * r = result.data( detail::permit<T>() );
+
+      for ( int k = 0; k < N; ++k )
+      {
+         r[k] = m_value[ k * m_size + i ];
+      }
+      return result;
+   }
+
+   /**
+    * set i-th vector.
+    */
+   void set( size_type const i, vector_type const & v )
+   {
+      value_type const * a = v.data( detail::permit<T>() );
+
+      for ( int k = 0; k < N; ++k )
+      {
+         m_value[ k * m_size + i ] = a[k];
+      }
+   }
+
+   /**
+    * this += rhs * s, e.g. position += velocity * dt; dimensions checked at compile time.
+    * Throws quantity_error if rhs has a different number of vectors.
+    */
+   template< typename RhsDims, typename ScaleDims, typename Y >
+   this_type & add_scaled( quantity_vector_array< RhsDims, T, N > const & rhs, quantity< ScaleDims, Y > const & s )
+   {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+      static_assert(
+         (detail::equal_dimensions< TYPENAME_TYPE_K detail::product< RhsDims, ScaleDims, T >::dimension_type, Dims >::value),
+         "scaled vectors must have the dimensions of the target" );
+#else
+      PHYS_UNITS_STATIC_ASSERT_TYPE(
+         (detail::equal_dimensions< TYPENAME_TYPE_K detail::product< RhsDims, ScaleDims, T >::dimension_type, Dims >::value),
+         scaled_vectors_must_have_dimensions_of_target );
+      (void) sizeof( ERROR__scaled_vectors_must_have_dimensions_of_target );
+#endif
+
+      if ( rhs.size() != m_size )
+      {
+         throw quantity_error( "quantity: vector array: add_scaled: arrays differ in size" );
+      }
+
+      value_type const f = value_type( s.get( detail::permit<Y>() ) );
+
+      for ( int k = 0; k < N; ++k )
+      {
+         value_type       * a = component( k, detail::permit<T>() );
+         value_type const * b = rhs.component( k, detail::permit<T>() );
+
+         for ( size_type i = 0; i < m_size; ++i )
+         {
+            a[i] += f * b[i];
+         }
+      }
+      return *this;
+   }
+
+   /**
+    * permit access to the k-th component array (non-const).
+    */
+   value_type * component( int const k, detail::permit< value_type > const & )
+   {
+      return m_size ? &m_value[ k * m_size ] : 0;
+   }
+
+   /**
+    * permit access to the k-th component array (const).
+    */
+   value_type const * component( int const k, detail::permit< value_type > const & ) const
+   {
+      return m_size ? &m_value[ k * m_size ] : 0;
+   }
+
+private:
+   size_type m_size;
+   std::vector< value_type > m_value;
+};
+
+}}} // namespace ct { namespace units { namespace phys {
+
+#endif // PHYS_UNITS_QUANTITY_VECTOR_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,80 @@
+/*
+ * TestAtomic.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_atomic.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+TEST_CASE( "atomic/access", "Atomic quantity load, store and exchange" )
+{
+    atomic_quantity< energy_d > e;
+
+    REQUIRE( b( e.load() ) == "0.000000 m+2 kg s-2" );
+
+    e.store( 2 * joule() );
+    REQUIRE( b( e.load() ) == "2.000000 m+2 kg s-2" );
+
+    REQUIRE( b( e.exchange( 3 * joule() ) ) == "2.000000 m+2 kg s-2" );
+    REQUIRE( b( e.load() ) == "3.000000 m+2 kg s-2" );
+
+    e = 4 * joule();
+    quantity< energy_d > now = e;
+    REQUIRE( b( now ) == "4.000000 m+2 kg s-2" );
+
+    atomic_quantity< electric_charge_d > q( 5 * coulomb() );
+    REQUIRE( b( q.load( std::memory_order_acquire ) ) == "5.000000 s A" );
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+    REQUIRE( e.is_lock_free() );
+#endif
+}
+
+TEST_CASE( "atomic/modify", "Atomic quantity read-modify-write" )
+{
+    atomic_quantity< energy_d > e( 1 * joule() );
+
+    REQUIRE( b( e.fetch_add( 2 * joule() ) ) == "1.000000 m+2 kg s-2" );
+    REQUIRE( b( e.fetch_sub( 0.5 * joule() ) ) == "3.000000 m+2 kg s-2" );
+    REQUIRE( b( e += 1 * joule() ) == "3.500000 m+2 kg s-2" );
+    REQUIRE( b( e -= 2 * joule() ) == "1.500000 m+2 kg s-2" );
+
+    quantity< energy_d > expected( 1 * joule() );
+
+    REQUIRE_FALSE( e.compare_exchange_strong( expected, 7 * joule() ) );
+    REQUIRE( b( expected ) == "1.500000 m+2 kg s-2" );
+
+    REQUIRE( e.compare_exchange_strong( expected, 7 * joule() ) );
+    REQUIRE( b( e.load() ) == "7.000000 m+2 kg s-2" );
+
+    while ( ! e.compare_exchange_weak( expected, 8 * joule() ) )
+    {
+    }
+    REQUIRE( b( e.load() ) == "8.000000 m+2 kg s-2" );
+
+// fetch_add() needs quantity with the same dimensions:
+// uncomment next line for compile-time error:
+//    e.fetch_add( 1 * coulomb() );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
@@ -0,0 +1,154 @@
+/*
+ * TestCalculus.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_calculus.hpp"
+
+#include <vector>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+typedef quantity< time_interval_d > time_type;
+typedef quantity< power_d         > power_type;
+typedef quantity< energy_d        > energy_type;
+typedef quantity< length_d        > length_type;
+typedef quantity< speed_d         > speed_type;
+
+TEST_CASE( "calculus/trapezoid", "Trapezoidal integration" )
+{
+    // P(t) = 2 W + 1 W/s * t over [0, 10] s: E = 70 J, exact for a linear integrand
+
+    const int n = 11;
+    time_type  t[n];
+    power_type p[n];
+
+    for ( int i = 0; i < n; ++i )
+    {
+        t[i] = i * second();
+        p[i] = 2 * watt() + i * watt();
+    }
+
+    REQUIRE( b( trapezoid( p, t, n ) ) == "70.000000 m+2 kg s-2" );
+    REQUIRE( b( trapezoid( p, n, 1 * second() ) ) == "70.000000 m+2 kg s-2" );
+
+    REQUIRE( b( trapezoid( p, t, 1 ) ) == "0.000000 m+2 kg s-2" );
+    REQUIRE( b( trapezoid( p, 0, 1 * second() ) ) == "0.000000 m+2 kg s-2" );
+
+    // dimensionless result collapses to the representation type
+
+    quantity< frequency_d > f[n];
+    for ( int i = 0; i < n; ++i )
+    {
+        f[i] = 3 / second();
+    }
+
+    REQUIRE( s( trapezoid( f, t, n ) ) == "30.000000" );
+}
+
+TEST_CASE( "calculus/simpson", "Simpson integration" )
+{
+    // y = t^2 over [0, T]: T^3 / 3, exact for odd and even sample counts
+
+    time_type  t[8];
+    quantity< dimensions<0,0,2> > y[8];
+
+    for ( int i = 0; i < 8; ++i )
+    {
+        t[i] = i * second();
+        y[i] = t[i] * t[i];
+    }
+
+    REQUIRE( b( simpson( y, 7, 1 * second() ) ) == b( 72 * second() * second() * second() ) );
+    REQUIRE( b( simpson( y, 8, 1 * second() ) ) == b( 343.0 / 3 * second() * second() * second() ) );
+    REQUIRE( b( simpson( y, 4, 1 * second() ) ) == b( 9 * second() * second() * second() ) );
+    REQUIRE( b( simpson( y, 3, 1 * second() ) ) == b( 8.0 / 3 * second() * second() * second() ) );
+
+    REQUIRE_THROWS_AS( simpson( y, 2, 1 * second() ), quantity_error );
+}
+
+TEST_CASE( "calculus/cumulative", "Cumulative integration" )
+{
+    // constant power of 1 W over a series that spans several scan blocks with OpenMP
+
+    const int n = 40001;
+    std::vector< time_type   > t( n );
+    std::vector< power_type  > p( n, 1 * watt() );
+    std::vector< energy_type > e( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        t[i] = 1e-3 * i * second();
+    }
+
+    cumulative_trapezoid( &p[0], &t[0], n, &e[0] );
+
+    REQUIRE( b( e[0]     ) == "0.000000 m+2 kg s-2" );
+    REQUIRE( b( e[1000]  ) == "1.000000 m+2 kg s-2" );
+    REQUIRE( b( e[16384] ) == "16.384000 m+2 kg s-2" );
+    REQUIRE( b( e[16385] ) == "16.385000 m+2 kg s-2" );
+    REQUIRE( b( e[n - 1] ) == "40.000000 m+2 kg s-2" );
+
+    REQUIRE( b( e[n - 1] ) == b( trapezoid( &p[0], &t[0], n ) ) );
+}
+
+TEST_CASE( "calculus/derivative", "Finite-difference differentiation" )
+{
+    // x(t) = 1 m/s^2 * t^2: v(t) = 2 m/s^2 * t, exact for a quadratic
+
+    const int n = 6;
+    time_type   t[n];
+    length_type x[n];
+    speed_type  v[n];
+
+    for ( int i = 0; i < n; ++i )
+    {
+        t[i] = i * second();
+        x[i] = i * i * meter();
+    }
+
+    derivative( x, n, 1 * second(), v );
+
+    REQUIRE( b( v[0] ) == "0.000000 m s-1" );
+    REQUIRE( b( v[2] ) == "4.000000 m s-1" );
+    REQUIRE( b( v[5] ) == "10.000000 m s-1" );
+
+    // non-uniform time axis
+
+    double const tt[n] = { 0, 0.5, 2, 2.5, 4, 7 };
+
+    for ( int i = 0; i < n; ++i )
+    {
+        t[i] = tt[i] * second();
+        x[i] = tt[i] * tt[i] * meter();
+    }
+
+    derivative( x, t, n, v );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        REQUIRE( b( v[i] ) == b( 2 * tt[i] * meter() / second() ) );
+    }
+
+    derivative( x, t, 2, v );
+    REQUIRE( b( v[0] ) == "0.500000 m s-1" );
+
+    REQUIRE_THROWS_AS( derivative( x, t, 1, v ), quantity_error );
+    REQUIRE_THROWS_AS( derivative( x, 1, 1 * second(), v ), quantity_error );
+}
+
+/*
+ * end of file
+ */
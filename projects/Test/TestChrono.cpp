@@ -0,0 +1,60 @@
+/*
+ * TestChrono.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_chrono.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+TEST_CASE( "chrono/to-quantity", "Time quantity from std::chrono::duration" )
+{
+    REQUIRE( b( to_quantity( std::chrono::milliseconds( 1500 ) ) ) == "1.500000 s" );
+    REQUIRE( s( to_quantity( std::chrono::duration< double, std::micro >( 2.5 ) ) / ( micro() * second() ) ) == "2.500000" );
+    REQUIRE( to_quantity( std::chrono::hours( 2 ) ) == 2 * hour() );
+
+    // integer ticks of whole seconds stay integer and exact
+
+    quantity< time_interval_d, std::chrono::minutes::rep > m = to_quantity( std::chrono::minutes( 3 ) );
+    REQUIRE( detail::value_of( m ) == 180 );
+
+    // floating-point ticks keep their type
+
+    quantity< time_interval_d, float > f = to_quantity( std::chrono::duration< float, std::milli >( 250.0f ) );
+    REQUIRE( detail::value_of( f ) == 0.25f );
+}
+
+TEST_CASE( "chrono/to-duration", "std::chrono::duration from time quantity" )
+{
+    std::chrono::duration< double, std::milli > ms = as_duration( 2.5 * second() );
+    REQUIRE( ms.count() == 2500.0 );
+
+    std::chrono::milliseconds dt = to_duration< std::chrono::milliseconds >( 1.2345 * second() );
+    REQUIRE( dt.count() == 1234 );
+
+    std::chrono::seconds s = as_duration( to_quantity( std::chrono::minutes( 2 ) ) );
+    REQUIRE( s.count() == 120 );
+
+    REQUIRE( to_quantity( to_duration< std::chrono::nanoseconds >( 3 * minute() ) ) == 3 * minute() );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
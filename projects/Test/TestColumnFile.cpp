@@ -0,0 +1,163 @@
+/*
+ * TestColumnFile.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_column_file.hpp"
+
+#include <cstdint>  // for int16_t, int32_t
+#include <cstdio>   // for remove
+#include <fstream>
+#include <vector>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+namespace {
+
+char const * const path = "TestColumnFile.col";
+
+void write_file()
+{
+    std::vector< quantity< electric_potential_d > > u;
+    std::vector< quantity< electric_current_d, float > > i;
+
+    for ( int k = 0; k < 100; ++k )
+    {
+        u.push_back( ( 230 + k ) * volt() );
+        i.push_back( quantity< electric_current_d, float >( float( 0.5 + k * 1e-3 ) * ampere() ) );
+    }
+
+    column_file_writer w;
+    w.add( "voltage", &u[0], u.size() );
+    w.add( "current", &i[0], i.size() );
+    w.write( path );
+}
+
+} // anonymous namespace
+
+TEST_CASE( "column file/view", "Columns map to typed views without copying" )
+{
+    write_file();
+    {
+        column_file f( path );
+
+        REQUIRE( f.size() == 2 );
+        REQUIRE( f.info( 0 ).name == "voltage" );
+        REQUIRE( f.info( 0 ).dim[0] == 2 );
+        REQUIRE( f.info( 0 ).dim[3] == -1 );
+        REQUIRE( f.info( 1 ).kind == 'f' );
+        REQUIRE( f.info( 1 ).size == 4 );
+
+        column_view< electric_potential_d > u = f.column< electric_potential_d >( "voltage" );
+
+        REQUIRE( u.size() == 100 );
+        REQUIRE( u[0] == 230 * volt() );
+        REQUIRE( u[99] == 329 * volt() );
+        REQUIRE( reinterpret_cast< std::size_t >( u.data() ) % 64 == 0 );
+
+        column_view< electric_current_d, float > i = f.column< electric_current_d, float >( "current" );
+
+        REQUIRE( i[10] / ampere() == Approx( 0.51 ) );
+    }
+    std::remove( path );
+}
+
+TEST_CASE( "column file/scale", "Scaled columns are copied with their scale applied" )
+{
+    std::vector< quantity< electric_current_d > > i;
+    for ( int k = 0; k < 10; ++k )
+    {
+        i.push_back( k * milli() * ampere() );
+    }
+
+    column_file_writer w;
+    w.add( "current", &i[0], i.size(), 1e-3 );
+    w.write( path );
+    {
+        column_file f( path );
+
+        REQUIRE( f.info( 0 ).scale == 1e-3 );
+        REQUIRE_THROWS_AS( f.column< electric_current_d >( "current" ), quantity_error );
+
+        std::vector< quantity< electric_current_d > > c = f.copy_column< electric_current_d >( "current" );
+
+        REQUIRE( c.size() == 10 );
+        REQUIRE( c[7] / ampere() == Approx( 7e-3 ) );
+    }
+    std::remove( path );
+}
+
+TEST_CASE( "column file/integral scale", "Scaled integral columns round to nearest and saturate" )
+{
+    typedef quantity< electric_current_d, std::int32_t > current32;
+    typedef quantity< electric_current_d, std::int16_t > current16;
+
+    std::vector< current32 > i;
+    i.push_back( detail::from_value< electric_current_d >( std::int32_t( 2999 ) ) );
+    i.push_back( detail::from_value< electric_current_d >( std::int32_t( -2999 ) ) );
+    i.push_back( detail::from_value< electric_current_d >( std::int32_t( 2499 ) ) );
+
+    std::vector< current16 > j;
+    j.push_back( detail::from_value< electric_current_d >( std::int16_t( 30000 ) ) );
+    j.push_back( detail::from_value< electric_current_d >( std::int16_t( -30000 ) ) );
+
+    column_file_writer w;
+    w.add( "thousands", &i[0], i.size(), 1000 );
+    w.add( "halves", &j[0], j.size(), 0.5 );
+    w.write( path );
+    {
+        column_file f( path );
+
+        std::vector< current32 > c = f.copy_column< electric_current_d, std::int32_t >( "thousands" );
+
+        REQUIRE( detail::value_of( c[0] ) == 3000 );
+        REQUIRE( detail::value_of( c[1] ) == -3000 );
+        REQUIRE( detail::value_of( c[2] ) == 2000 );
+
+        // stored saturated at 32767 and -32768 halves
+
+        std::vector< current16 > d = f.copy_column< electric_current_d, std::int16_t >( "halves" );
+
+        REQUIRE( detail::value_of( d[0] ) == 16384 );
+        REQUIRE( detail::value_of( d[1] ) == -16384 );
+    }
+    std::remove( path );
+}
+
+TEST_CASE( "column file/errors", "Mismatched requests and invalid files throw" )
+{
+    write_file();
+    {
+        column_file f( path );
+
+        REQUIRE_THROWS_AS( f.column< electric_current_d >( "voltage" ), quantity_error );
+        REQUIRE_THROWS_AS( f.column< electric_current_d >( "current" ), quantity_error );
+        REQUIRE_THROWS_AS( f.column< electric_potential_d >( "power" ), quantity_error );
+    }
+    std::remove( path );
+
+    std::ofstream( path ) << "time,voltage\n0,230\n";
+    REQUIRE_THROWS_AS( column_file( path ), quantity_error );
+    std::remove( path );
+
+    REQUIRE_THROWS_AS( column_file( path ), quantity_error );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
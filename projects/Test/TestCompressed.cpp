@@ -0,0 +1,242 @@
+/*
+ * TestCompressed.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_compressed.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+namespace {
+
+typedef quantity< thermodynamic_temperature_d > temperature;
+
+/**
+ * 1000 samples a second apart with some jitter, a slow temperature drift,
+ * a repeated value and a few special values.
+ */
+compressed_series< thermodynamic_temperature_d > make_series( std::vector< std::int64_t > & times, std::vector< temperature > & values )
+{
+    compressed_series< thermodynamic_temperature_d > s( 100 );
+
+    std::int64_t t = 1700000000000LL;
+    for ( int k = 0; k < 1000; ++k )
+    {
+        t += k == 500 ? 1000000 : k % 7 == 0 ? 1003 : 1000;
+
+        double v = 293.15 + 0.01 * std::floor( 100 * std::sin( k * 1e-2 ) );
+        if ( k == 10 ) v = 0;
+        if ( k == 11 ) v = -0.0;
+        if ( k == 12 ) v = std::numeric_limits< double >::infinity();
+        if ( k == 13 ) v = std::numeric_limits< double >::denorm_min();
+
+        times.push_back( t );
+        values.push_back( v * kelvin() );
+        s.append( t, values.back() );
+    }
+    return s;
+}
+
+/**
+ * stream s with the 64-bit word at byte position at set to v.
+ */
+std::string patch( std::string s, std::size_t const at, std::uint64_t const v )
+{
+    std::memcpy( &s[at], &v, sizeof v );
+    return s;
+}
+
+/**
+ * true if reading a series from stream s throws quantity_error.
+ */
+bool rejects( std::string const & s )
+{
+    std::istringstream is( s );
+    try
+    {
+        compressed_series< thermodynamic_temperature_d > c( is );
+    }
+    catch ( quantity_error const & )
+    {
+        return true;
+    }
+    return false;
+}
+
+bool same_bits( temperature const & a, temperature const & b )
+{
+    double const x = a / kelvin();
+    double const y = b / kelvin();
+    return std::memcmp( &x, &y, sizeof x ) == 0;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "compressed series/decode", "Samples are restored exactly" )
+{
+    std::vector< std::int64_t > times;
+    std::vector< temperature > values;
+
+    compressed_series< thermodynamic_temperature_d > const s = make_series( times, values );
+
+    REQUIRE( s.size() == 1000 );
+    REQUIRE( s.block_count() == 10 );
+    REQUIRE( s.block( 1 ).first == times[100] );
+    REQUIRE( s.block( 1 ).last == times[199] );
+    REQUIRE( s.bytes() < 1000 * 16 / 3 );
+
+    std::vector< std::int64_t > t;
+    std::vector< temperature > v;
+
+    s.decode( t, v );
+
+    REQUIRE( t == times );
+    REQUIRE( v.size() == values.size() );
+
+    for ( std::size_t k = 0; k < v.size(); ++k )
+    {
+        REQUIRE( same_bits( v[k], values[k] ) );
+    }
+}
+
+TEST_CASE( "compressed series/range", "Range queries decode the overlapping blocks" )
+{
+    std::vector< std::int64_t > times;
+    std::vector< temperature > values;
+
+    compressed_series< thermodynamic_temperature_d > const s = make_series( times, values );
+
+    REQUIRE( s.first_block( times[250] ) == 2 );
+    REQUIRE( s.first_block( times[0] - 1 ) == 0 );
+    REQUIRE( s.first_block( times[999] + 1 ) == 10 );
+
+    std::vector< std::int64_t > t;
+    std::vector< temperature > v;
+
+    REQUIRE( s.decode( times[250], times[420], t, v ) == 171 );
+    REQUIRE( t.front() == times[250] );
+    REQUIRE( t.back() == times[420] );
+    REQUIRE( same_bits( v[0], values[250] ) );
+    REQUIRE( same_bits( v[170], values[420] ) );
+
+    REQUIRE( s.decode( times[250] + 1, times[251] - 1, t, v ) == 0 );
+    REQUIRE( s.decode( times[999] + 1, times[999] + 1000, t, v ) == 0 );
+    REQUIRE( t.size() == 171 );
+}
+
+TEST_CASE( "compressed series/stream", "Streams keep the dimensions and allow appending" )
+{
+    std::vector< std::int64_t > times;
+    std::vector< temperature > values;
+
+    std::stringstream ss;
+    make_series( times, values ).write( ss );
+
+    compressed_series< thermodynamic_temperature_d > s( ss );
+
+    REQUIRE( s.size() == 1000 );
+    REQUIRE( s.block_size() == 100 );
+
+    s.append( times.back() + 1000, 300 * kelvin() );
+
+    REQUIRE( s.block_count() == 11 );
+
+    std::vector< std::int64_t > t;
+    std::vector< temperature > v;
+
+    s.decode( t, v );
+
+    REQUIRE( t.size() == 1001 );
+    REQUIRE( same_bits( v[999], values[999] ) );
+    REQUIRE( v[1000] == 300 * kelvin() );
+
+    ss.clear();
+    ss.seekg( 0 );
+    REQUIRE_THROWS_AS( compressed_series< pressure_d >( ss ), quantity_error );
+
+    std::stringstream garbage( "not a compressed series" );
+    REQUIRE_THROWS_AS( compressed_series< thermodynamic_temperature_d >( garbage ), quantity_error );
+
+    REQUIRE_THROWS_AS( s.append( times.back(), 300 * kelvin() ), quantity_error );
+}
+
+TEST_CASE( "compressed series/corrupt", "Truncated and corrupt streams throw" )
+{
+    // header: blocks at byte 40, words at 48; index entry i at 64 + 32 i: offset at +16, count at +24
+
+    std::vector< std::int64_t > times;
+    std::vector< temperature > values;
+
+    std::stringstream ss;
+    make_series( times, values ).write( ss );
+    std::string const good = ss.str();
+
+    REQUIRE_FALSE( rejects( good ) );
+
+    REQUIRE( rejects( good.substr( 0, good.size() - 8 ) ) );
+    REQUIRE( rejects( patch( good, 48, std::uint64_t( 1 ) << 60 ) ) );
+    REQUIRE( rejects( patch( good, 40, std::uint64_t( 1 ) << 58 ) ) );
+
+    std::uint64_t offset1;
+    std::memcpy( &offset1, &good[64 + 32 + 16], sizeof offset1 );
+
+    REQUIRE( rejects( patch( good, 64 + 16, offset1 ) ) );
+    REQUIRE( rejects( patch( good, 64 + 32 + 16, 0 ) ) );
+    REQUIRE( rejects( patch( good, 64 + 9 * 32 + 16, std::uint64_t( 1 ) << 40 ) ) );
+
+    // a last block with more samples than its words can hold
+
+    std::string const big = patch( patch( patch( good, 24, 100000 ), 32, 1000 - 100 + 90000 ), 64 + 9 * 32 + 24, 90000 );
+    REQUIRE( rejects( big ) );
+
+    // coded bits that run past the words decode to zeros
+
+    std::string zeros = good;
+    std::memset( &zeros[ zeros.size() - 64 ], 0, 64 );
+
+    std::istringstream is( zeros );
+    compressed_series< thermodynamic_temperature_d > c( is );
+
+    std::vector< std::int64_t > t;
+    std::vector< temperature > v;
+    c.decode( t, v );
+
+    REQUIRE( t.size() == 1000 );
+
+    // a value window with leading zeros 31 and length 64 is rejected
+
+    std::string ones = good;
+    std::memset( &ones[ ones.size() - 64 ], 0xff, 64 );
+
+    std::istringstream is_ones( ones );
+    compressed_series< thermodynamic_temperature_d > d( is_ones );
+
+    REQUIRE_THROWS_AS( d.decode( t, v ), quantity_error );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
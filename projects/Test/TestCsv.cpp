@@ -0,0 +1,201 @@
+/*
+ * TestCsv.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_csv.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+TEST_CASE( "csv/read", "The reader converts columns to SI by their header units" )
+{
+    std::istringstream is(
+        "time [s],\"power [kW]\",state,temperature [degC],flow [L/min]\r\n"
+        "0,1.5,1,20.5,60\r\n"
+        "0.5,2,0,21,\r\n"
+        "\r\n"
+        "1,+2.5e3,1,21.5,120\r\n" );
+
+    csv_reader r( is );
+
+    REQUIRE( r.size() == 5 );
+    REQUIRE( r.name( 1 ) == "power" );
+    REQUIRE( r.unit( 1 ) == "kW" );
+    REQUIRE( r.unit( 2 ) == "" );
+
+    std::vector< quantity< time_interval_d > > t;
+    std::vector< quantity< power_d > > p;
+    std::vector< quantity< dimensions< 3, 0, -1 > > > f;
+    std::vector< int > state;
+
+    r.bind( "time", t );
+    r.bind( "power", p );
+    r.bind( "flow", f );
+    r.bind( "state", state );
+
+    REQUIRE( r.read() == 3 );
+    REQUIRE( r.read() == 0 );
+    REQUIRE( r.rows() == 3 );
+
+    REQUIRE( t[2] == 1 * second() );
+    REQUIRE( p[0] == 1500 * watt() );
+    REQUIRE( p[2] / watt() == Approx( 2.5e6 ) );
+    REQUIRE( f[0] / ( cube( meter() ) / second() ) == Approx( 1e-3 ) );
+    REQUIRE( std::isnan( f[1] / ( cube( meter() ) / second() ) ) );
+    REQUIRE( state[1] == 0 );
+
+    // blanks around a field are skipped, with std::from_chars and strtod() alike
+
+    std::istringstream blanks( "a [m],b [m]\n1, 2\n 3 ,\t4\t\n5, \n" );
+    csv_reader br( blanks );
+
+    std::vector< quantity< length_d > > a;
+    std::vector< quantity< length_d > > b;
+
+    br.bind( "a", a );
+    br.bind( "b", b );
+
+    REQUIRE( br.read() == 3 );
+    REQUIRE( b[0] == 2 * meter() );
+    REQUIRE( a[1] == 3 * meter() );
+    REQUIRE( b[1] == 4 * meter() );
+    REQUIRE( std::isnan( b[2] / meter() ) );
+}
+
+TEST_CASE( "csv/chunks", "The reader reads in chunks, in parallel parts" )
+{
+    std::ostringstream os;
+    os << "i [1],length [mm]\n";
+    for ( int i = 0; i < 10000; ++i )
+    {
+        os << i << "," << i * 0.5 << "\n";
+    }
+
+    std::istringstream is( os.str() );
+    csv_reader r( is, ',', 3, 4096 );
+
+    std::vector< double > index;
+    std::vector< quantity< length_d > > length;
+
+    r.bind( "i", index );
+    r.bind( "length", length );
+
+    int row = 0;
+    int chunks = 0;
+    bool ok = true;
+
+    while ( std::size_t const n = r.read() )
+    {
+        for ( std::size_t k = 0; k < n; ++k, ++row )
+        {
+            ok = ok && index[k] == row && std::fabs( length[k] / meter() - row * 0.5e-3 ) < 1e-12;
+        }
+        ++chunks;
+    }
+
+    REQUIRE( ok );
+    REQUIRE( row == 10000 );
+    REQUIRE( chunks > 10 );
+}
+
+TEST_CASE( "csv/errors", "Mismatches and malformed rows throw" )
+{
+    std::istringstream is( "time [s],temperature [degC],power [kW]\n0,20,1\n1,21,x\n" );
+    csv_reader r( is );
+
+    std::vector< quantity< time_interval_d > > t;
+    std::vector< quantity< power_d > > p;
+    std::vector< quantity< thermodynamic_temperature_d > > k;
+
+    REQUIRE_THROWS_AS( r.bind( "power", t ), quantity_error );
+    REQUIRE_THROWS_AS( r.bind( "temperature", k ), quantity_error );
+    REQUIRE_THROWS_AS( r.bind( "energy", p ), quantity_error );
+
+    r.bind( "power", p );
+    REQUIRE_THROWS_AS( r.read(), quantity_error );
+
+    std::istringstream fields( "a [m],b [m]\n1,2,3\n" );
+    csv_reader s( fields );
+    REQUIRE_THROWS_AS( s.read(), quantity_error );
+
+    // an empty or out-of-range field in an integral column
+
+    std::vector< int > n;
+
+    std::istringstream empty( "n,m\n1,2\n3,4\n,5\n" );
+    csv_reader u( empty );
+    u.bind( "n", n );
+    REQUIRE_THROWS_WITH( u.read(), "quantity: csv: data row 3: empty or out-of-range value in integral column 'n'" );
+
+    std::istringstream large( "n\n1e10\n" );
+    csv_reader v( large );
+    v.bind( "n", n );
+    REQUIRE_THROWS_AS( v.read(), quantity_error );
+}
+
+TEST_CASE( "csv/write", "The writer writes unit headers and reads back" )
+{
+    std::vector< quantity< time_interval_d > > t;
+    std::vector< quantity< length_d > > d;
+    std::vector< quantity< dimensions< 3, 0, -1 > > > f;
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        t.push_back( i * 0.1 * second() );
+        d.push_back( ( 1.5 + i * 1e-3 ) * milli() * meter() );
+        f.push_back( i * cube( meter() ) / hour() );
+    }
+
+    csv_writer w;
+    w.add( "time", &t[0], t.size() );
+    w.add_eng( "distance", &d[0], d.size() );
+    w.add( "flow", &f[0], f.size(), "m3/h" );
+
+    std::ostringstream os;
+    w.write( os );
+
+    REQUIRE( os.str().substr( 0, os.str().find( '\n' ) ) == "time [s],distance [mm],flow [m3/h]" );
+
+    std::istringstream is( os.str() );
+    csv_reader r( is );
+
+    std::vector< quantity< time_interval_d > > t2;
+    std::vector< quantity< length_d > > d2;
+    std::vector< quantity< dimensions< 3, 0, -1 > > > f2;
+
+    r.bind( "time", t2 );
+    r.bind( "distance", d2 );
+    r.bind( "flow", f2 );
+
+    REQUIRE( r.read() == 4 );
+    REQUIRE( t2[3] / second() == Approx( 0.3 ) );
+    REQUIRE( d2[3] / meter() == Approx( 1.503e-3 ) );
+    REQUIRE( f2[2] / ( cube( meter() ) / hour() ) == Approx( 2 ) );
+
+    std::vector< quantity< power_d > > shorter( 2 );
+    w.add( "extra", &shorter[0], shorter.size() );
+    REQUIRE_THROWS_AS( w.write( os ), quantity_error );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
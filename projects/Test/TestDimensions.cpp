@@ -0,0 +1,65 @@
+/*
+ * TestDimensions.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+TEST_CASE( "dimensions/members", "Dimension exponents and properties" )
+{
+    REQUIRE( energy_d::dim1 == 2 );
+    REQUIRE( energy_d::dim2 == 1 );
+    REQUIRE( energy_d::dim3 == -2 );
+    REQUIRE( energy_d::dim7 == 0 );
+
+    REQUIRE( dimensionless_d::is_all_zero );
+    REQUIRE( length_d::is_base );
+    REQUIRE_FALSE( speed_d::is_base );
+
+    REQUIRE( energy_d() != force_d() );
+    REQUIRE( energy_d() == dimensions< 2, 1, -2 >() );
+}
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+TEST_CASE( "dimensions/code", "Dimensions packed into one integer" )
+{
+    REQUIRE( dimension_code< dimensionless_d >::value == 0 );
+    REQUIRE( dimension_code< length_d >::value == 1 );
+    REQUIRE( dimension_code< mass_d >::value == 256 );
+    REQUIRE( dimension_code< energy_d >::value == 2 + 256 - 2 * 65536 );
+    REQUIRE( dimension_code< dimensions< 0, 0, 0, 0, 0, 0, -1 > >::value == -( 1LL << 48 ) );
+
+    REQUIRE( dimension_code< detail::product< force_d, length_d, Rep >::dimension_type >::value ==
+             dimension_code< energy_d >::value );
+
+    typedef dimensions< -128, 127, 5, -7, 0, 1, -1 > extreme_d;
+
+    REQUIRE( extreme_d::dim1 == -128 );
+    REQUIRE( extreme_d::dim2 == 127 );
+    REQUIRE( extreme_d::dim4 == -7 );
+    REQUIRE( extreme_d::dim7 == -1 );
+
+// dimension exponents must be in the range -128..127:
+// uncomment next line for compile-time error:
+//    dimension_code< dimensions< 128, 0, 0 > >::value;
+
+#ifdef PHYS_UNITS_PACKED_DIMENSIONS
+    REQUIRE( energy_d() == packed_dimensions< dimension_code< energy_d >::value >() );
+#endif
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
@@ -0,0 +1,107 @@
+/*
+ * TestDual.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_dual.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+typedef dual< Rep, 2 > d2;
+
+TEST_CASE( "dual/arithmetic", "Dual number derivatives" )
+{
+    d2 const x( 2.0, 0 );
+    d2 const y( 3.0, 1 );
+
+    REQUIRE( ( x * y ).d( 0 ) == 3.0 );
+    REQUIRE( ( x * y ).d( 1 ) == 2.0 );
+    REQUIRE( ( x / y ).d( 1 ) == -2.0 / 9.0 );
+    REQUIRE( ( x - y ).d( 1 ) == -1.0 );
+    REQUIRE( ( 2.0 * x + 1.0 ).d( 0 ) == 2.0 );
+    REQUIRE( pow( x, y ).value() == 8.0 );
+    REQUIRE( pow( x, y ).d( 0 ) == 12.0 );
+    REQUIRE( s( sqrt( d2( 4.0, 0 ) ).d( 0 ) ) == "0.250000" );
+    REQUIRE( s( exp( x ).d( 0 ) ) == s( std::exp( 2.0 ) ) );
+    REQUIRE( s( log( x ).d( 0 ) ) == "0.500000" );
+    REQUIRE( fabs( -x ).d( 0 ) == 1.0 );
+}
+
+TEST_CASE( "dual/quantity", "Dual quantities and typed derivatives" )
+{
+    quantity< length_d, d2 > x = seed<2>( 0.1 * meter(), 0 );
+    quantity< mass_d, d2 >   m = seed<2>( 2.0 * kilogram(), 1 );
+
+    quantity< energy_d, d2 > e = m * x * 9.81 * meter() / second() / second();
+
+    REQUIRE( b( primal( e ) ) == "1.962000 m+2 kg s-2" );
+    REQUIRE( b( derivative< length_d >( e, 0 ) ) == "19.620000 m kg s-2" );
+    REQUIRE( b( derivative< mass_d >( e, 1 ) ) == "0.981000 m+2 s-2" );
+
+    // quantity functions
+
+    REQUIRE( b( derivative< length_d >( nth_power<3>( x ), 0 ) ) == "0.030000 m+2" );
+    REQUIRE( b( derivative< length_d >( sqrt( x * x ), 0 ) ) == "1.000000" );
+    REQUIRE( b( derivative< length_d >( nth_root<2>( x * x ), 0 ) ) == "1.000000" );
+    REQUIRE( b( derivative< length_d >( abs( -x ), 0 ) ) == "1.000000" );
+
+    quantity< length_d, d2 > u = seed<2>( 3.0 * meter(), 0 );
+    quantity< length_d, d2 > v = seed<2>( 4.0 * meter(), 1 );
+
+    REQUIRE( b( primal( hypot( u, v ) ) ) == "5.000000 m" );
+    REQUIRE( b( derivative< length_d >( hypot( u, v ), 0 ) ) == "0.600000" );
+    REQUIRE( b( derivative< length_d >( hypot( u, v ), 1 ) ) == "0.800000" );
+    REQUIRE( b( derivative< length_d >( hypot( u, v, u ), 0 ) ) == s( 6 / std::sqrt( 34.0 ) ) );
+    REQUIRE( b( primal( fma( u, v, u * v ) ) ) == "24.000000 m+2" );
+    REQUIRE( b( derivative< length_d >( fma( u, v, u * u ), 0 ) ) == "10.000000 m" );
+
+    // dimensionless result
+
+    REQUIRE( s( primal( x / meter() ) ) == "0.100000" );
+    REQUIRE( b( derivative< length_d >( x / meter(), 0 ) ) == "1.000000 m-1" );
+
+    // dual times quantity
+
+    REQUIRE( b( primal( d2( 3.0, 0 ) * meter() ) ) == "3.000000 m" );
+    REQUIRE( b( derivative< dimensionless_d >( x * ( d2( 2.0, 1 ) * meter() ), 1 ) ) == "0.100000 m+2" );
+    REQUIRE( b( derivative< dimensionless_d >( x * ( meter() * d2( 2.0, 1 ) ), 1 ) ) == "0.100000 m+2" );
+
+    REQUIRE( to_string( x ) == "0.1 [1, 0] m" );
+}
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+TEST_CASE( "dual/seeds", "Dual quantities with recorded seed dimensions" )
+{
+    typedef dimension_list< length_d, mass_d > seeds;
+    typedef dual< Rep, 2, seeds > ds;
+
+    quantity< length_d, ds > x = seed< seeds, 0 >( 0.1 * meter() );
+    quantity< mass_d, ds >   m = seed< seeds, 1 >( 2.0 * kilogram() );
+
+    quantity< energy_d, ds > e = m * x * 9.81 * meter() / second() / second();
+
+    REQUIRE( b( primal( e ) ) == "1.962000 m+2 kg s-2" );
+    REQUIRE( b( derivative< 0 >( e ) ) == "19.620000 m kg s-2" );
+    REQUIRE( b( derivative< 1 >( e ) ) == "0.981000 m+2 s-2" );
+    REQUIRE( b( derivative< 0 >( x / meter() ) ) == "1.000000 m-1" );
+    REQUIRE( b( derivative< 1 >( m * ( ds( 3.0 ) * meter() ) ) ) == "3.000000 m" );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
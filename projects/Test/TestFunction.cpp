@@ -13,6 +13,8 @@
 #include "catch.hpp"
 #include "phys/units/quantity.hpp"
 
+#include <cmath>
+
 #ifdef PHYS_UNITS_IN_CT_NAMESPACE
 using namespace ct::phys::units;
 using namespace ct::phys::units::io;
@@ -79,8 +81,47 @@ TEST_CASE( "quantity/function/various", "Quantity, various functions" )
     REQUIRE( b(abs( -m ) ) == "1.000000 m" );
 }
 
+TEST_CASE( "quantity/function/fma", "Quantity fused multiply-add" )
+{
+    quantity<length_d>        x0( 1 * meter() );
+    quantity<speed_d>         v ( 2 * meter() / second() );
+    quantity<time_interval_d> t ( 3 * second() );
+
+    REQUIRE( b(fma( v, t, x0 ) ) == "7.000000 m" );
+    REQUIRE( b(fma( t, v, x0 ) ) == "7.000000 m" );
+    REQUIRE( b(fma( v, t, -x0 ) ) == "5.000000 m" );
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+    // single rounding: ( 1 + 2^-30 ) * ( 1 - 2^-30 ) - 1 is exactly -2^-60,
+    // whereas separate multiply and add round the product to 1 and yield 0.
+
+    quantity<length_d> p( ( 1 + std::ldexp( 1.0, -30 ) ) * meter() );
+    quantity<length_d> q( ( 1 - std::ldexp( 1.0, -30 ) ) * meter() );
+    quantity<area_d>   one( 1 * meter() * meter() );
+
+    REQUIRE( fma( p, q, -one ) == -std::ldexp( 1.0, -60 ) * meter() * meter() );
+#endif
+}
+
+TEST_CASE( "quantity/function/hypot", "Quantity hypotenuse" )
+{
+    REQUIRE( b(hypot( 3 * meter(), 4 * meter() ) ) == "5.000000 m" );
+    REQUIRE( b(hypot( -3 * meter(), 4 * meter() ) ) == "5.000000 m" );
+    REQUIRE( b(hypot( 2 * meter(), 3 * meter(), 6 * meter() ) ) == "7.000000 m" );
+
+    // no overflow or underflow of the intermediate squares
+
+    REQUIRE( s(hypot( 3e300 * meter(), 4e300 * meter() ) / ( 1e300 * meter() ) ) == "5.000000" );
+    REQUIRE( s(hypot( 3e-300 * meter(), 4e-300 * meter() ) / ( 1e-300 * meter() ) ) == "5.000000" );
+    REQUIRE( s(hypot( 2e300 * meter(), 3e300 * meter(), 6e300 * meter() ) / ( 1e300 * meter() ) ) == "7.000000" );
+}
+
 TEST_CASE( "quantity/function/exception", "Quantity function exceptions" )
 {
+// addend of fma must have the dimensions of the product:
+// uncomment next line for compile-time error:
+//    fma( meter(), meter(), meter() );
+
 // dimension powers must be even mutiples:
 // uncomment next line fr compile-time error:
 //    nth_root<2>( meter() * meter() / second() );
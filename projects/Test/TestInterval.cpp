@@ -0,0 +1,147 @@
+/*
+ * TestInterval.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_interval.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+typedef interval<> iv;
+
+/**
+ * true if [lo, hi] lies within x and x is no wider than [lo, hi] plus a few units in the last place.
+ */
+static bool encloses( iv const & x, Rep const lo, Rep const hi )
+{
+    Rep const slack = 4 * std::numeric_limits<Rep>::epsilon() * ( std::fabs( lo ) + std::fabs( hi ) ) + 1e-300;
+
+    return x.lower() <= lo && hi <= x.upper() && x.lower() >= lo - slack && x.upper() <= hi + slack;
+}
+
+TEST_CASE( "interval/arithmetic", "Interval arithmetic with outward rounding" )
+{
+    REQUIRE( encloses( iv( 1, 2 ) + iv( 3, 4 ), 4, 6 ) );
+    REQUIRE( encloses( iv( 1, 2 ) - iv( 3, 4 ), -3, -1 ) );
+    REQUIRE( encloses( iv( -1, 2 ) * iv( -3, 4 ), -6, 8 ) );
+    REQUIRE( encloses( iv( 1, 2 ) / iv( 4, 8 ), 0.125, 0.5 ) );
+    REQUIRE( encloses( -iv( 1, 2 ), -2, -1 ) );
+
+    // rounding: the exact sum of 0.1 and 0.2 lies strictly inside
+
+    iv const sum = iv( 0.1 ) + iv( 0.2 );
+
+    REQUIRE( sum.lower() < sum.upper() );
+    REQUIRE( sum.contains( 0.3 ) );
+
+    // division by an interval that contains zero
+
+    REQUIRE( ( iv( 1 ) / iv( -1, 1 ) ).upper() == std::numeric_limits<Rep>::infinity() );
+
+    // zero times an infinite bound
+
+    Rep const inf = std::numeric_limits<Rep>::infinity();
+
+    iv const p = iv( 0, 1 ) * iv( 1, inf );
+    iv const q = iv( 0, 1 ) * ( iv( 2, 3 ) / iv( -1, 1 ) );
+
+    REQUIRE( p.contains( 0 ) );
+    REQUIRE( p.upper() == inf );
+    REQUIRE( q.lower() == -inf );
+    REQUIRE( q.upper() == inf );
+
+    // overflow keeps a finite lower bound
+
+    REQUIRE( ( iv( 1e308 ) * iv( 10 ) ).lower() == ( std::numeric_limits<Rep>::max )() );
+
+    // a NaN bound stays NaN
+
+    Rep const nan = std::numeric_limits<Rep>::quiet_NaN();
+
+    iv const x = iv( nan ) + iv( 1 );
+    iv const y = iv( 1 ) - iv( nan );
+
+    REQUIRE( x.lower() != x.lower() );
+    REQUIRE( x.upper() != x.upper() );
+    REQUIRE( y.lower() != y.lower() );
+    REQUIRE( y.upper() != y.upper() );
+}
+
+TEST_CASE( "interval/functions", "Interval functions" )
+{
+    REQUIRE( encloses( fabs( iv( -3, 2 ) ), 0, 3 ) );
+    REQUIRE( encloses( fabs( iv( -3, -2 ) ), 2, 3 ) );
+    REQUIRE( encloses( square( iv( -2, 3 ) ), 0, 9 ) );
+    REQUIRE( encloses( sqrt( iv( 4, 9 ) ), 2, 3 ) );
+    REQUIRE( encloses( pow( iv( -2, 3 ), iv( 2 ) ), 0, 9 ) );
+    REQUIRE( encloses( pow( iv( -2, 3 ), iv( 3 ) ), -8, 27 ) );
+    REQUIRE( encloses( pow( iv( 2, 4 ), iv( -1 ) ), 0.25, 0.5 ) );
+    REQUIRE( encloses( pow( iv( -2, 3 ), iv( 0 ) ), 1, 1 ) );
+    REQUIRE( encloses( pow( iv( 4, 9 ), iv( 0.5 ) ), 2, 3 ) );
+    REQUIRE( encloses( hypot( iv( -3, 3 ), iv( 4, 5 ) ), 4, std::sqrt( 34.0 ) ) );
+    REQUIRE( encloses( hypot( iv( 3 ), iv( 4 ) ), 5, 5 ) );
+    REQUIRE( encloses( hypot( iv( -1, 0 ), iv( 0 ) ), 0, 1 ) );
+    REQUIRE( encloses( hypot( iv( 1 ), iv( 2 ), iv( 2 ) ), 3, 3 ) );
+    REQUIRE( encloses( fma( iv( 1, 2 ), iv( -3, 4 ), iv( 1 ) ), -5, 9 ) );
+}
+
+TEST_CASE( "interval/compare", "Tri-state interval comparisons" )
+{
+    REQUIRE(  certainly( iv( 1, 2 ) < iv( 3, 4 ) ) );
+    REQUIRE( !possibly( iv( 3, 4 ) < iv( 1, 2 ) ) );
+    REQUIRE(  indeterminate( iv( 1, 3 ) < iv( 2, 4 ) ) );
+    REQUIRE(  certainly( iv( 1, 2 ) <= iv( 2, 4 ) ) );
+    REQUIRE(  indeterminate( iv( 1, 2 ) >= iv( 2, 4 ) ) );
+
+    REQUIRE(  certainly( iv( 2 ) == iv( 2 ) ) );
+    REQUIRE(  certainly( iv( 1, 2 ) != iv( 3, 4 ) ) );
+    REQUIRE(  indeterminate( iv( 1, 3 ) == iv( 2 ) ) );
+}
+
+TEST_CASE( "interval/quantity", "Interval quantities" )
+{
+    quantity< electric_current_d, iv > i = iv( 1.9, 2.1 ) * ampere();
+    quantity< electric_resistance_d, iv > r = iv( 4.7, 5.3 ) * ohm();
+
+    quantity< power_d, iv > p = i * i * r;
+
+    REQUIRE( lower( p ) <= 1.9 * 1.9 * 4.7 * watt() );
+    REQUIRE( upper( p ) >= 2.1 * 2.1 * 5.3 * watt() );
+
+    REQUIRE(  certainly( p < iv( 25 ) * watt() ) );
+    REQUIRE( !possibly( p > iv( 25 ) * watt() ) );
+    REQUIRE(  indeterminate( p < iv( 20 ) * watt() ) );
+
+    // quantity functions
+
+    REQUIRE( lower( nth_power<2>( iv( -1, 2 ) * meter() ) ) == 0 * meter() * meter() );
+    REQUIRE( lower( sqrt( iv( 4, 9 ) * meter() * meter() ) ) <= 2 * meter() );
+    REQUIRE( upper( nth_root<2>( iv( 4, 9 ) * meter() * meter() ) ) >= 3 * meter() );
+    REQUIRE( lower( abs( iv( -3, -2 ) * meter() ) ) <= 2 * meter() );
+
+    quantity< length_d, iv > x = iv( 3, 4 ) * meter();
+
+    REQUIRE( lower( hypot( x, x ) ) <= 3 * std::sqrt( 2.0 ) * meter() );
+    REQUIRE( upper( hypot( x, x ) ) >= 4 * std::sqrt( 2.0 ) * meter() );
+    REQUIRE( lower( hypot( x, x, x ) ) <= 3 * std::sqrt( 3.0 ) * meter() );
+    REQUIRE( lower( fma( x, x, x * x ) ) <= 18 * meter() * meter() );
+    REQUIRE( upper( fma( x, x, x * x ) ) >= 32 * meter() * meter() );
+
+    REQUIRE( to_string( iv( 1, 2 ) * ampere() ) == "[1, 2] A" );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,44 @@
+/*
+ * TestIoFwd.cpp
+ *
+ * Output via quantity_io_fwd.hpp only: the IO functions are instantiated
+ * in TestOutput.cpp, like elsewhere in this program without named units.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io_fwd.hpp"
+
+#include <sstream>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+TEST_CASE( "output/fwd", "Quantity output with declarations only" )
+{
+    std::ostringstream os;
+
+    {
+        using namespace io;
+        os << 2 * meter() << ", " << 3 * joule();
+    }
+    REQUIRE( os.str() == "2 m, 3 m+2 kg s-2" );
+
+    REQUIRE( to_unit_symbol( watt() ) == "m+2 kg s-3" );
+    REQUIRE( to_unit_name( newton() ) == "m kg s-2" );
+    REQUIRE( io::to_string( 4 * volt() ) == "4 m+2 kg s-3 A-1" );
+
+    REQUIRE( io::eng::to_string( 1500 * meter() ) == "1.5 km" );
+    REQUIRE( io::eng::to_string( 1500 * meter(), 2 ) == "1.5 km" );
+    REQUIRE( to_eng_string( 0.002 * second() ) == "2 ms" );
+}
+
+/*
+ * end of file
+ */
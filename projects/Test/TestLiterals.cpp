@@ -0,0 +1,61 @@
+/*
+ * TestLiterals.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_literals.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::literals;
+#else
+using namespace phys::units;
+using namespace phys::units::literals;
+#endif
+
+// compile-time constants of the proper type
+
+constexpr quantity< electric_resistance_d > r = 4.7_kOhm;
+constexpr quantity< power_d >               p = 12_kW;
+constexpr quantity< capacitance_d >         c = 3.3_uF;
+constexpr quantity< acceleration_d >        g = 9.81_m_per_s2;
+
+static_assert( 1_kg == 1000_g, "kilogram is 1000 gram" );
+static_assert( 1.5_km == 1500_m, "kilometer is 1000 meter" );
+static_assert( 36_km_per_h == 10_m_per_s, "36 km/h is 10 m/s" );
+static_assert( 1_mOhm < 1_Ohm && 1_Ohm < 1_kOhm, "prefix order" );
+
+TEST_CASE( "literals/value", "Literal values equal prefix times unit" )
+{
+    REQUIRE( b( r ) == "4700.000000 m+2 kg s-3 A-2" );
+    REQUIRE( b( p ) == "12000.000000 m+2 kg s-3" );
+    REQUIRE( b( c ) == "0.000003 m-2 kg-1 s+4 A+2" );
+    REQUIRE( b( g ) == "9.810000 m s-2" );
+
+    REQUIRE( 4.7_kOhm == 4.7 * kilo() * ohm() );
+    REQUIRE( 25_mm == 25 * milli() * meter() );
+    REQUIRE( 2_ms == 2 * milli() * second() );
+    REQUIRE( 1_hPa == 100 * pascal() );
+    REQUIRE( 5_daN == 50 * newton() );
+    REQUIRE( 3_mmol == 3 * milli() * mole() );
+    REQUIRE( 1_MHz == mega() * hertz() );
+    REQUIRE( 1_GJ == giga() * joule() );
+    REQUIRE( 2_mT == 2 * milli() * tesla() );
+    REQUIRE( 1_Ts == tera() * second() );
+    REQUIRE( 500_lx == 500 * lux() );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
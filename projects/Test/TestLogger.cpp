@@ -0,0 +1,145 @@
+/*
+ * TestLogger.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_logger.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+namespace {
+
+std::size_t count_lines( std::string const & s )
+{
+    std::size_t n = 0;
+    for ( std::size_t i = 0; i < s.size(); ++i )
+    {
+        n += s[i] == '\n';
+    }
+    return n;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "logger/drain", "Records are formatted when drained" )
+{
+    quantity_logger log( 8 );
+
+    REQUIRE( log.log( "position", 1.5 * meter() ) );
+    REQUIRE( log.log( "period", 2 * second() ) );
+
+    std::ostringstream os;
+    REQUIRE( log.drain( os ) == 2 );
+
+    std::string const s = os.str();
+    REQUIRE( count_lines( s ) == 2 );
+    REQUIRE( s.find( " position 1.5 m\n" ) != std::string::npos );
+    REQUIRE( s.find( " period 2 s\n" ) < s.size() );
+    REQUIRE( s.find( "position" ) < s.find( "period" ) );
+
+    std::ostringstream empty;
+    REQUIRE( log.drain( empty ) == 0 );
+    REQUIRE( empty.str().empty() );
+
+    REQUIRE_THROWS_AS( quantity_logger( 6 ), quantity_error );
+}
+
+TEST_CASE( "logger/engineering", "Records can be drained in engineering units" )
+{
+    quantity_logger log( 8, true );
+
+    log.log( "gap", 0.0025 * meter() );
+
+    std::ostringstream os;
+    log.drain( os );
+
+    REQUIRE( os.str().find( " gap 2.5 mm\n" ) != std::string::npos );
+}
+
+TEST_CASE( "logger/several", "A thread can alternate between loggers" )
+{
+    // more loggers than entries in the thread's table, so that some share one
+
+    std::vector< std::unique_ptr< quantity_logger > > logs;
+
+    for ( int k = 0; k < 20; ++k )
+    {
+        logs.push_back( std::unique_ptr< quantity_logger >( new quantity_logger( 64 ) ) );
+    }
+
+    for ( int i = 0; i < 10; ++i )
+    {
+        for ( std::size_t k = 0; k < logs.size(); ++k )
+        {
+            REQUIRE( logs[k]->log( "x", static_cast< double >( k ) * meter() ) );
+        }
+    }
+
+    for ( std::size_t k = 0; k < logs.size(); ++k )
+    {
+        std::ostringstream os;
+        REQUIRE( logs[k]->drain( os ) == 10 );
+
+        std::ostringstream line;
+        line << " x " << k << " m\n";
+        REQUIRE( os.str().find( line.str() ) != std::string::npos );
+    }
+}
+
+TEST_CASE( "logger/full", "Records are dropped when a buffer is full" )
+{
+    quantity_logger log( 4 );
+
+    for ( int k = 0; k < 6; ++k )
+    {
+        log.log( "x", k * meter() );
+    }
+    REQUIRE( log.dropped() == 2 );
+
+    std::ostringstream os;
+    REQUIRE( log.drain( os ) == 4 );
+    REQUIRE( log.log( "x", 6 * meter() ) );
+    REQUIRE( log.drain( os ) == 1 );
+    REQUIRE( os.str().find( " x 3 m\n x" ) == std::string::npos );
+    REQUIRE( os.str().find( " x 6 m\n" ) != std::string::npos );
+}
+
+TEST_CASE( "logger/background", "The background thread drains until stopped" )
+{
+    std::ostringstream os;
+    {
+        quantity_logger log( 1024 );
+        log.start( os, std::chrono::milliseconds( 1 ) );
+
+        for ( int k = 0; k < 100; ++k )
+        {
+            log.log( "x", k * meter() );
+        }
+        log.stop();
+    }
+    REQUIRE( count_lines( os.str() ) == 100 );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
@@ -0,0 +1,114 @@
+/*
+ * TestLookup.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_lookup.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+typedef quantity< thermodynamic_temperature_d > temperature;
+typedef quantity< electric_resistance_d       > resistance;
+
+typedef lookup_table< thermodynamic_temperature_d, electric_resistance_d > resistance_table;
+
+TEST_CASE( "lookup/non-uniform", "Lookup table with non-uniform keys" )
+{
+    temperature const t[] = { 200 * kelvin(), 250 * kelvin(), 300 * kelvin(), 400 * kelvin(), 600 * kelvin() };
+    resistance  const r[] = { 1 * ohm(), 2 * ohm(), 3 * ohm(), 5 * ohm(), 11 * ohm() };
+
+    resistance_table table( t, r, 5 );
+
+    REQUIRE( table.size() == 5 );
+    REQUIRE( !table.uniform() );
+
+    REQUIRE( b( table.key( 3 ) ) == "400.000000 K" );
+    REQUIRE( b( table.value( 3 ) ) == b( 5 * ohm() ) );
+    REQUIRE( b( table.value( 4 ) ) == b( 11 * ohm() ) );
+    REQUIRE( b( table.slope( 3 ) ) == b( 0.03 * ohm() / kelvin() ) );
+
+    REQUIRE( table.segment( 100 * kelvin() ) == 0 );
+    REQUIRE( table.segment( 250 * kelvin() ) == 1 );
+    REQUIRE( table.segment( 399 * kelvin() ) == 2 );
+    REQUIRE( table.segment( 700 * kelvin() ) == 3 );
+
+    REQUIRE( b( table( 200 * kelvin() ) ) == b( 1 * ohm() ) );
+    REQUIRE( b( table( 275 * kelvin() ) ) == b( 2.5 * ohm() ) );
+    REQUIRE( b( table( 350 * kelvin() ) ) == b( 4 * ohm() ) );
+    REQUIRE( b( table( 600 * kelvin() ) ) == b( 11 * ohm() ) );
+
+    // linear extrapolation from the end segments
+
+    REQUIRE( b( table( 150 * kelvin() ) ) == b( 0 * ohm() ) );
+    REQUIRE( b( table( 700 * kelvin() ) ) == b( 14 * ohm() ) );
+}
+
+TEST_CASE( "lookup/uniform", "Lookup table with uniform keys" )
+{
+    resistance const r[] = { 1 * ohm(), 2 * ohm(), 4 * ohm(), 8 * ohm() };
+
+    resistance_table table( 100 * kelvin(), 50 * kelvin(), r, 4 );
+
+    REQUIRE( table.uniform() );
+    REQUIRE( b( table.key( 2 ) ) == "200.000000 K" );
+
+    REQUIRE( table.segment(  50 * kelvin() ) == 0 );
+    REQUIRE( table.segment( 175 * kelvin() ) == 1 );
+    REQUIRE( table.segment( 300 * kelvin() ) == 2 );
+
+    REQUIRE( b( table( 125 * kelvin() ) ) == b( 1.5 * ohm() ) );
+    REQUIRE( b( table( 225 * kelvin() ) ) == b( 6 * ohm() ) );
+    REQUIRE( b( table( 250 * kelvin() ) ) == b( 8 * ohm() ) );
+    REQUIRE( b( table(  50 * kelvin() ) ) == b( 0 * ohm() ) );
+}
+
+TEST_CASE( "lookup/batch", "Lookup table batch evaluation" )
+{
+    temperature const t[] = { 0 * kelvin(), 10 * kelvin(), 30 * kelvin() };
+    resistance  const r[] = { 0 * ohm(), 10 * ohm(), 50 * ohm() };
+
+    resistance_table table( t, r, 3 );
+
+    temperature const x[] = { 5 * kelvin(), 20 * kelvin(), 30 * kelvin() };
+    resistance y[3];
+
+    table( x, 3, y );
+
+    REQUIRE( b( y[0] ) == b( 5 * ohm() ) );
+    REQUIRE( b( y[1] ) == b( 30 * ohm() ) );
+    REQUIRE( b( y[2] ) == b( 50 * ohm() ) );
+
+    // dimensionless values collapse to the representation type
+
+    Rep const ratio[] = { 1, 2, 3 };
+
+    lookup_table< thermodynamic_temperature_d, dimensionless_d > scale( t, ratio, 3 );
+
+    REQUIRE( s( scale( 20 * kelvin() ) ) == "2.500000" );
+}
+
+TEST_CASE( "lookup/exception", "Lookup table exceptions" )
+{
+    temperature const t[] = { 0 * kelvin(), 10 * kelvin(), 10 * kelvin() };
+    resistance  const r[] = { 0 * ohm(), 10 * ohm(), 50 * ohm() };
+
+    REQUIRE_THROWS_AS( resistance_table( t, r, 1 ), quantity_error );
+    REQUIRE_THROWS_AS( resistance_table( t, r, 3 ), quantity_error );
+    REQUIRE_THROWS_AS( resistance_table( 0 * kelvin(), 0 * kelvin(), r, 3 ), quantity_error );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,143 @@
+/*
+ * TestMatrix.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_matrix.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+namespace {
+
+// state [ position, velocity ] and its transition, x' = F x:
+
+typedef dimension_list< length_d, speed_d > state_d;
+typedef dimension_list< dimensions< -1, 0, 0 >, dimensions< -1, 0, 1 > > per_state_d;
+typedef dimension_list< dimensionless_d > column_d;
+
+typedef quantity_matrix< state_d, state_d > covariance;
+typedef quantity_matrix< state_d, per_state_d > transition;
+typedef quantity_matrix< state_d, column_d > state;
+
+transition make_transition( quantity<time_interval_d> const & dt )
+{
+    transition F = transition::identity();
+    F.set<0,1>( dt );
+    return F;
+}
+
+covariance make_covariance()
+{
+    covariance P;
+    P.set<0,0>( 4 * meter() * meter() );
+    P.set<0,1>( 2 * meter() * meter() / second() );
+    P.set<1,0>( 2 * meter() * meter() / second() );
+    P.set<1,1>( 5 * meter() * meter() / second() / second() );
+    return P;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "matrix/element", "Quantity matrix element dimensions" )
+{
+    covariance P = make_covariance();
+
+    REQUIRE( b( P.get<0,0>() ) == "4.000000 m+2" );
+    REQUIRE( b( P.get<0,1>() ) == "2.000000 m+2 s-1" );
+    REQUIRE( b( P.get<1,1>() ) == "5.000000 m+2 s-2" );
+
+    transition F = make_transition( 0.5 * second() );
+
+    REQUIRE( s( F.get<0,0>() ) == "1.000000" );
+    REQUIRE( b( F.get<0,1>() ) == "0.500000 s" );
+    REQUIRE( b( F.get<1,0>() ) == "0.000000 s-1" );
+    REQUIRE( s( F.get<1,1>() ) == "1.000000" );
+}
+
+TEST_CASE( "matrix/arithmetic", "Quantity matrix addition and scaling" )
+{
+    covariance P = make_covariance();
+
+    REQUIRE( b( ( P + P ).get<1,1>() ) == "10.000000 m+2 s-2" );
+    REQUIRE( b( ( P - P ).get<0,1>() ) == "0.000000 m+2 s-1" );
+    REQUIRE( b( ( -P ).get<0,0>() ) == "-4.000000 m+2" );
+    REQUIRE( b( ( 3 * P ).get<0,0>() ) == "12.000000 m+2" );
+    REQUIRE( b( ( P * 3 ).get<1,0>() ) == "6.000000 m+2 s-1" );
+}
+
+TEST_CASE( "matrix/product", "Quantity matrix product and transpose" )
+{
+    transition F = make_transition( 1 * second() );
+
+    // predict state: x' = F x
+
+    state x;
+    x.set<0,0>( 10 * meter() );
+    x.set<1,0>( 2 * meter() / second() );
+
+    state x1 = F * x;
+
+    REQUIRE( b( x1.get<0,0>() ) == "12.000000 m" );
+    REQUIRE( b( x1.get<1,0>() ) == "2.000000 m s-1" );
+
+    // predict covariance: P' = F P F^T
+
+    covariance P1 = F * make_covariance() * transpose( F );
+
+    REQUIRE( b( P1.get<0,0>() ) == "13.000000 m+2" );
+    REQUIRE( b( P1.get<0,1>() ) == "7.000000 m+2 s-1" );
+    REQUIRE( b( P1.get<1,0>() ) == "7.000000 m+2 s-1" );
+    REQUIRE( b( P1.get<1,1>() ) == "5.000000 m+2 s-2" );
+
+    quantity_matrix< per_state_d, state_d > Ft = transpose( F );
+    REQUIRE( b( Ft.get<1,0>() ) == "1.000000 s" );
+}
+
+TEST_CASE( "matrix/cholesky", "Quantity matrix Cholesky factorization" )
+{
+    covariance P = make_covariance();
+
+    quantity_matrix< state_d, dimension_list< dimensionless_d, dimensionless_d > > L = cholesky( P );
+
+    REQUIRE( b( L.get<0,0>() ) == "2.000000 m" );
+    REQUIRE( b( L.get<0,1>() ) == "0.000000 m" );
+    REQUIRE( b( L.get<1,0>() ) == "1.000000 m s-1" );
+    REQUIRE( b( L.get<1,1>() ) == "2.000000 m s-1" );
+
+    covariance LLt = L * transpose( L );
+
+    REQUIRE( b( LLt.get<0,1>() ) == "2.000000 m+2 s-1" );
+    REQUIRE( b( LLt.get<1,1>() ) == "5.000000 m+2 s-2" );
+
+    P.set<1,1>( 1 * meter() * meter() / second() / second() );
+
+    REQUIRE_THROWS_AS( cholesky( P ), quantity_error );
+}
+
+TEST_CASE( "matrix/exception", "Quantity matrix exceptions" )
+{
+// inner dimensions of a product must be uniform:
+// uncomment next line for compile-time error:
+//    make_covariance() * make_covariance();
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
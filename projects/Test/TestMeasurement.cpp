@@ -0,0 +1,114 @@
+/*
+ * TestMeasurement.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_measurement.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+typedef measurement<> m;
+
+std::string s( m const & x )
+{
+    std::ostringstream os;
+    os.setf( std::ios::fixed, std::ios::floatfield );
+    os << std::setprecision(6) << x;
+    return os.str();
+}
+
+TEST_CASE( "measurement/arithmetic", "Measurement first-order uncertainty propagation" )
+{
+    REQUIRE( b( m( 3, 0.3 ) * meter() ) == "(3.000000 +/- 0.300000) m" );
+    REQUIRE( b( meter() * m( 3, 0.3 ) ) == "(3.000000 +/- 0.300000) m" );
+
+    quantity< electric_potential_d, m > v = m( 12.0, 0.1 ) * volt();
+    quantity< electric_current_d, m >   i = m(  2.0, 0.05 ) * ampere();
+
+    REQUIRE( b( v * i ) == "(24.000000 +/- 0.632456) m+2 kg s-3" );
+    REQUIRE( b( v / i ) == "(6.000000 +/- 0.158114) m+2 kg s-3 A-2" );
+    REQUIRE( b( v + v ) == "(24.000000 +/- 0.141421) m+2 kg s-3 A-1" );
+    REQUIRE( b( 2.0 * v ) == "(24.000000 +/- 0.200000) m+2 kg s-3 A-1" );
+    REQUIRE( b( v / 4.0 ) == "(3.000000 +/- 0.025000) m+2 kg s-3 A-1" );
+    REQUIRE( b( -v ) == "(-12.000000 +/- 0.100000) m+2 kg s-3 A-1" );
+
+    quantity< electric_potential_d, m > w( 1 * volt() );
+
+    w += v;
+    REQUIRE( b( w ) == "(13.000000 +/- 0.100000) m+2 kg s-3 A-1" );
+
+    REQUIRE( s( v / volt() ) == "(12.000000 +/- 0.100000)" );
+    REQUIRE( v > 11 * volt() );
+}
+
+TEST_CASE( "measurement/correlation", "Measurement correlation by source" )
+{
+    m const x( 4, 0.2 );
+    m const c( 4, 0.2, 1 );
+
+    REQUIRE( s( x - x ) == "(0.000000 +/- 0.282843)" );
+    REQUIRE( s( c - c ) == "(0.000000 +/- 0.000000)" );
+    REQUIRE( s( c + c ) == "(8.000000 +/- 0.400000)" );
+    REQUIRE( s( c * c ) == "(16.000000 +/- 1.600000)" );
+    REQUIRE( s( c / c ) == "(1.000000 +/- 0.000000)" );
+
+    REQUIRE( ( 2.0 * c ).source() == 1 );
+    REQUIRE( ( c + x ).source() == 0 );
+    REQUIRE( c.relative_uncertainty() == 0.05 );
+}
+
+TEST_CASE( "measurement/function", "Measurement with quantity functions" )
+{
+    quantity< length_d, m > l = m( 3, 0.3, 1 ) * meter();
+
+    REQUIRE( b( nth_power<2>( l ) ) == "(9.000000 +/- 1.800000) m+2" );
+    REQUIRE( b( nth_root<2>( l * l ) ) == "(3.000000 +/- 0.300000) m" );
+    REQUIRE( b( sqrt( m( 4, 0.4 ) * meter() * meter() ) ) == "(2.000000 +/- 0.100000) m" );
+    REQUIRE( b( abs( -l ) ) == "(3.000000 +/- 0.300000) m" );
+
+    quantity< length_d, m > x = m( 3, 0.3 ) * meter();
+    quantity< length_d, m > y = m( 4, 0.4 ) * meter();
+
+    REQUIRE( b( hypot( x, y ) ) == "(5.000000 +/- 0.367151) m" );
+    REQUIRE( b( hypot( m( 3 ) * meter(), m( 4 ) * meter(), m( 12 ) * meter() ) ) == "(13.000000 +/- 0.000000) m" );
+    REQUIRE( b( fma( m( 2, 0.1 ) * meter(), m( 3, 0.2 ) * meter(), m( 1, 0.1 ) * meter() * meter() ) ) == "(7.000000 +/- 0.509902) m+2" );
+
+    REQUIRE( to_string( l ) == "(3 +/- 0.3) m" );
+}
+
+TEST_CASE( "measurement/arrays", "Measurement propagation over value and uncertainty arrays" )
+{
+    quantity< electric_potential_d > v[2]  = { 12 * volt(), 6 * volt() };
+    quantity< electric_potential_d > uv[2] = { 0.1 * volt(), 0.1 * volt() };
+    quantity< electric_current_d >   i[2]  = { 2 * ampere(), 3 * ampere() };
+    quantity< electric_current_d >   ui[2] = { 0.05 * ampere(), 0 * ampere() };
+
+    quantity< power_d > p[2], up[2];
+
+    propagate_product( v, uv, i, ui, 2, p, up );
+    REQUIRE( b( p[0] ) == "24.000000 m+2 kg s-3" );
+    REQUIRE( b( up[0] ) == "0.632456 m+2 kg s-3" );
+    REQUIRE( b( up[1] ) == "0.300000 m+2 kg s-3" );
+
+    quantity< electric_resistance_d > r[2], ur[2];
+
+    propagate_quotient( v, uv, i, ui, 2, r, ur );
+    REQUIRE( b( r[0] ) == "6.000000 m+2 kg s-3 A-2" );
+    REQUIRE( b( ur[0] ) == "0.158114 m+2 kg s-3 A-2" );
+}
+
+/*
+ * end of file
+ */
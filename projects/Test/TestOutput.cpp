@@ -12,6 +12,12 @@
 
 #include "catch.hpp"
 #include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io_instantiate.hpp"
+
+// IO for the common dimensions, for translation units that only include
+// quantity_io_fwd.hpp, such as TestIoFwd.cpp.
+
+PHYS_UNITS_IO_INSTANTIATE_COMMON( template )
 
 #ifdef PHYS_UNITS_IN_CT_NAMESPACE
 using namespace ct::phys::units;
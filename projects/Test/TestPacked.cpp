@@ -0,0 +1,173 @@
+/*
+ * TestPacked.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_packed.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+TEST_CASE( "packed array/fixed scale", "Codes round to the scale and saturate" )
+{
+    packed_quantity_array< electric_potential_d > u( 10, 10 * volt() / 32768, 1 * volt() );
+
+    REQUIRE( u.size() == 10 );
+    REQUIRE( u.bytes() == 10 * 2 + 2 * 8 );
+    REQUIRE( u[3] == 1 * volt() );
+
+    u.set( 0, 3 * volt() );
+    REQUIRE( u.codes()[0] == 6554 );
+    REQUIRE( u[0] / volt() == Approx( 3 ).epsilon( 1e-4 ) );
+
+    u.set( 1, 100 * volt() );
+    REQUIRE( u.codes()[1] == 32767 );
+
+    u.set( 2, -100 * volt() );
+    REQUIRE( u.codes()[2] == -32767 );
+
+    packed_quantity_array< electric_potential_d, std::uint16_t > adc( 4, 1 * milli() * volt() );
+
+    adc.set( 0, -5 * volt() );
+    adc.set( 1, 70 * volt() );
+    REQUIRE( adc.codes()[0] == 0 );
+    REQUIRE( adc.codes()[1] == 65535 );
+
+    REQUIRE_THROWS_AS( ( packed_quantity_array< electric_potential_d >( 10, 0 * volt() ) ), quantity_error );
+}
+
+TEST_CASE( "packed array/fitted", "Fitted blocks encode and decode within half a code step" )
+{
+    std::vector< quantity< electric_current_d > > i;
+    for ( int k = 0; k < 1000; ++k )
+    {
+        i.push_back( ( k < 500 ? 1e-3 * k : 100.0 + 0.01 * k ) * ampere() );
+    }
+
+    packed_quantity_array< electric_current_d > p( &i[0], i.size(), 256 );
+
+    REQUIRE( p.block_count() == 4 );
+    REQUIRE( p.scale( 0 ) < p.scale( 2 ) );
+
+    std::vector< quantity< electric_current_d > > d( i.size() );
+    p.decode( 0, d.size(), &d[0] );
+
+    for ( std::size_t k = 0; k < d.size(); ++k )
+    {
+        REQUIRE( abs( d[k] - i[k] ) <= 0.5 * p.scale( k / 256 ) );
+        REQUIRE( d[k] == p[k] );
+    }
+
+    std::vector< quantity< electric_current_d > > c( 10, 2 * ampere() );
+    packed_quantity_array< electric_current_d > q( &c[0], c.size() );
+
+    REQUIRE( q[5] == 2 * ampere() );
+
+    p.encode( 250, &c[0], c.size() );
+    REQUIRE( p[249] == d[249] );
+    REQUIRE( p[255] / ampere() == Approx( 0.255 ) );   // saturated in block 0
+    REQUIRE( p[256] / ampere() == Approx( 2 ).epsilon( 1e-4 ) );
+}
+
+TEST_CASE( "packed array/nan", "NaN takes the most negative signed code and decodes to NaN" )
+{
+    double const nan = std::numeric_limits< double >::quiet_NaN();
+
+    std::vector< quantity< length_d > > x;
+    x.push_back( 1 * meter() );
+    x.push_back( 2 * meter() );
+    x.push_back( nan * meter() );
+    x.push_back( 3 * meter() );
+
+    packed_quantity_array< length_d > p( &x[0], x.size() );
+
+    REQUIRE( p.codes()[2] == -32768 );
+    REQUIRE( p[0] / meter() == Approx( 1 ) );
+    REQUIRE( p[3] / meter() == Approx( 3 ) );
+    REQUIRE( p[2] != p[2] );
+
+    std::vector< quantity< length_d > > d( x.size() );
+    p.decode( 0, d.size(), &d[0] );
+
+    REQUIRE( d[1] / meter() == Approx( 2 ) );
+    REQUIRE( d[2] != d[2] );
+    REQUIRE( sum( p ) != sum( p ) );
+    REQUIRE( sum( p * 2 ) != sum( p * 2 ) );
+
+    p.set( 1, nan * meter() );
+    REQUIRE( p.codes()[1] == -32768 );
+
+    packed_quantity_array< length_d > all( &x[2], 1 );
+    REQUIRE( all[0] != all[0] );
+
+    // unsigned codes have no code for NaN
+
+    packed_quantity_array< length_d, std::uint16_t > u( 4, 1 * milli() * meter() );
+
+    REQUIRE_THROWS_AS( u.set( 0, nan * meter() ), quantity_error );
+    REQUIRE_THROWS_AS( u.encode( 0, &x[0], x.size() ), quantity_error );
+    REQUIRE_THROWS_AS( ( packed_quantity_array< length_d, std::uint16_t >( &x[0], x.size() ) ), quantity_error );
+}
+
+TEST_CASE( "packed array/expressions", "Expressions decode lazily in fused loops" )
+{
+    std::size_t const n = 1000;
+
+    std::vector< quantity< electric_potential_d > > u;
+    std::vector< quantity< electric_current_d > > i;
+    for ( std::size_t k = 0; k < n; ++k )
+    {
+        u.push_back( ( 230 + 0.01 * k ) * volt() );
+        i.push_back( ( 1 + 0.001 * k ) * ampere() );
+    }
+
+    packed_quantity_array< electric_potential_d > pu( &u[0], n, 128 );
+    packed_quantity_array< electric_current_d > pi( &i[0], n, 128 );
+
+    quantity< power_d > p = 0 * watt();
+    quantity< electric_potential_d > su = 0 * volt();
+    for ( std::size_t k = 0; k < n; ++k )
+    {
+        p += pu[k] * pi[k];
+        su += pu[k];
+    }
+
+    REQUIRE( sum( pu * pi ) / watt() == Approx( p / watt() ) );
+    REQUIRE( sum( pu ) / volt() == Approx( su / volt() ) );
+    REQUIRE( mean( pu ) / volt() == Approx( su / volt() / n ) );
+    REQUIRE( mean( pu - 230 * volt() ) / volt() == Approx( su / volt() / n - 230 ) );
+    REQUIRE( mean( 2 * pu / pi ) / ohm() == Approx( 2 * mean( pu / pi ) / ohm() ) );
+
+    Rep const ratio = sum( pu / pu );
+    REQUIRE( ratio == Approx( n ) );
+
+    std::vector< quantity< power_d > > power( n );
+    evaluate( pu * pi * 0.5, &power[0] );
+
+    REQUIRE( power[7] / watt() == Approx( 0.5 * ( pu[7] * pi[7] ) / watt() ) );
+
+    packed_quantity_array< electric_current_d > other( &i[0], n, 256 );
+    REQUIRE_THROWS_AS( sum( pu * other ), quantity_error );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
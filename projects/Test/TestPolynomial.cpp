@@ -0,0 +1,93 @@
+/*
+ * TestPolynomial.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_polynomial.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+typedef polynomial< time_interval_d, length_d, 2 > trajectory;
+
+TEST_CASE( "polynomial/coefficient", "Polynomial coefficient dimensions" )
+{
+    // x(t) = x0 + v t + a t^2 / 2
+
+    trajectory x( 1 * meter(), 2 * meter() / second(), -4.9 * meter() / second() / second() );
+
+    REQUIRE( b( x.get<0>() ) == "1.000000 m" );
+    REQUIRE( b( x.get<1>() ) == "2.000000 m s-1" );
+    REQUIRE( b( x.get<2>() ) == "-4.900000 m s-2" );
+
+    x.set<1>( 3 * meter() / second() );
+    REQUIRE( b( x.get<1>() ) == "3.000000 m s-1" );
+
+    REQUIRE( trajectory::degree == 2 );
+    REQUIRE( b( trajectory().get<2>() ) == "0.000000 m s-2" );
+
+    // coefficients that collapse to the representation type
+
+    polynomial< length_d, length_d, 1 > scale( 1 * meter(), 2.0 );
+
+    REQUIRE( s( scale.get<1>() ) == "2.000000" );
+    REQUIRE( b( scale( 3 * meter() ) ) == "7.000000 m" );
+    REQUIRE( b( scale.estrin( 3 * meter() ) ) == "7.000000 m" );
+}
+
+TEST_CASE( "polynomial/evaluate", "Polynomial evaluation" )
+{
+    trajectory x( 1 * meter(), 2 * meter() / second(), -4.9 * meter() / second() / second() );
+
+    REQUIRE( b( x( 0 * second() ) ) == "1.000000 m" );
+    REQUIRE( b( x( 1 * second() ) ) == "-1.900000 m" );
+    REQUIRE( b( x.estrin( 1 * second() ) ) == "-1.900000 m" );
+    REQUIRE( b( x( 2 * second() ) ) == "-14.600000 m" );
+
+    // degree four, Horner and Estrin agree
+
+    typedef polynomial< thermodynamic_temperature_d, dimensionless_d, 4 > quartic;
+
+    quartic q( 1.0, 1.0 / kelvin(), 1.0 / kelvin() / kelvin(),
+        1.0 / kelvin() / kelvin() / kelvin(), 1.0 / kelvin() / kelvin() / kelvin() / kelvin() );
+
+    REQUIRE( s( q( 2 * kelvin() ) ) == "31.000000" );
+    REQUIRE( s( q.estrin( 2 * kelvin() ) ) == "31.000000" );
+
+    // batch
+
+    quantity< time_interval_d > t[3] = { 0 * second(), 1 * second(), 2 * second() };
+    quantity< length_d > y[3];
+
+    x( t, 3, y );
+    REQUIRE( b( y[2] ) == "-14.600000 m" );
+
+    x.estrin( t, 3, y );
+    REQUIRE( b( y[1] ) == "-1.900000 m" );
+}
+
+TEST_CASE( "polynomial/exception", "Polynomial exceptions" )
+{
+// number of coefficients must be degree + 1:
+// uncomment next line for compile-time error:
+//    trajectory( 1 * meter(), 2 * meter() / second() );
+
+// coefficient index must not exceed degree:
+// uncomment next line for compile-time error:
+//    trajectory().get<3>();
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,158 @@
+/*
+ * TestRing.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#if defined( PHYS_UNITS_CPP11_OR_GREATER ) && ! defined( _WIN32 )
+
+#include "phys/units/quantity_ring.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+namespace {
+
+std::string ring_name( char const * const which )
+{
+    std::ostringstream os;
+    os << "/TestRing-" << which << "-" << ::getpid();
+    return os.str();
+}
+
+} // anonymous namespace
+
+TEST_CASE( "ring/batches", "Batches pass through the ring with their dimensions" )
+{
+    std::string const name = ring_name( "batches" );
+
+    quantity_ring producer( name, 4, 100 * sizeof( Rep ) );
+    quantity_ring consumer( name );
+
+    REQUIRE( consumer.slots() == 4 );
+    REQUIRE( consumer.capacity() == 100 * sizeof( Rep ) );
+    REQUIRE( consumer.empty() );
+
+    std::vector< quantity< electric_potential_d > > u( 100, 230 * volt() );
+    std::vector< quantity< electric_current_d, float > > i( 10, quantity< electric_current_d, float >( 2.0f * ampere() ) );
+
+    REQUIRE( producer.try_push( &u[0], u.size() ) );
+    REQUIRE( producer.try_push( &i[0], i.size() ) );
+    REQUIRE( producer.try_push( &u[0], 3 ) );
+    REQUIRE( producer.try_push( &u[0], 4 ) );
+    REQUIRE_FALSE( producer.try_push( &u[0], 5 ) );
+
+    REQUIRE_FALSE( consumer.empty() );
+    REQUIRE( consumer.holds< electric_potential_d >() );
+    REQUIRE_FALSE( consumer.holds< electric_current_d >() );
+    REQUIRE_FALSE( consumer.holds< electric_potential_d, float >() );
+
+    column_view< electric_potential_d > v = consumer.front< electric_potential_d >();
+    REQUIRE( v.size() == 100 );
+    REQUIRE( v[99] == 230 * volt() );
+    consumer.pop();
+
+    REQUIRE_THROWS_AS( consumer.front< electric_current_d >(), quantity_error );
+
+    column_view< electric_current_d, float > c = consumer.front< electric_current_d, float >();
+    REQUIRE( c.size() == 10 );
+    REQUIRE( c[0] == quantity< electric_current_d, float >( 2.0f * ampere() ) );
+    consumer.pop();
+
+    REQUIRE( producer.try_push( &u[0], 5 ) );
+
+    consumer.pop();
+    consumer.pop();
+    REQUIRE( consumer.front< electric_potential_d >().size() == 5 );
+    consumer.pop();
+
+    REQUIRE( consumer.empty() );
+    REQUIRE_THROWS_AS( consumer.pop(), quantity_error );
+    REQUIRE_THROWS_AS( producer.try_push( &u[0], 101 ), quantity_error );
+
+    REQUIRE_THROWS_AS( quantity_ring( name, 3, 64 ), quantity_error );
+    REQUIRE_THROWS_AS( quantity_ring( ring_name( "missing" ) ), quantity_error );
+}
+
+TEST_CASE( "ring/processes", "Producer processes and a consumer process share the ring" )
+{
+    std::string const name = ring_name( "processes" );
+
+    int const producers = 3;
+    int const batches = 200;
+
+    quantity_ring ring( name, 8, 16 * sizeof( Rep ), quantity_ring::multi_producer );
+
+    for ( int p = 0; p < producers; ++p )
+    {
+        if ( ::fork() == 0 )
+        {
+            quantity_ring child( name );
+            std::vector< quantity< electric_potential_d > > u( 16 );
+
+            for ( int b = 0; b < batches; ++b )
+            {
+                for ( int k = 0; k < 16; ++k )
+                {
+                    u[k] = ( 1000 * p + b ) * volt();
+                }
+                while ( ! child.try_push( &u[0], u.size() ) )
+                {
+                    ::usleep( 10 );
+                }
+            }
+            ::_exit( 0 );
+        }
+    }
+
+    std::vector< int > next( producers, 0 );
+    bool in_order = true;
+
+    for ( int received = 0; received < producers * batches; )
+    {
+        if ( ring.empty() )
+        {
+            ::usleep( 10 );
+            continue;
+        }
+        column_view< electric_potential_d > u = ring.front< electric_potential_d >();
+
+        int const v = static_cast< int >( u[0] / volt() );
+        in_order = in_order && u[15] == u[0] && v % 1000 == next[ v / 1000 ];
+        ++next[ v / 1000 ];
+        ++received;
+
+        ring.pop();
+    }
+
+    for ( int p = 0; p < producers; ++p )
+    {
+        int status;
+        ::wait( &status );
+    }
+
+    REQUIRE( in_order );
+    REQUIRE( ring.empty() );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER && ! _WIN32
+
+/*
+ * end of file
+ */
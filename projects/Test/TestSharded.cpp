@@ -0,0 +1,90 @@
+/*
+ * TestSharded.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_sharded.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+TEST_CASE( "sharded/total", "Sharded accumulator add and total" )
+{
+    sharded_accumulator< electric_charge_d > q( 4 );
+
+    REQUIRE( q.size() == 4 );
+    REQUIRE( b( q.total() ) == "0.000000 s A" );
+
+    q.add( 1 * coulomb(), 0 );
+    q.add( 2 * coulomb(), 1 );
+    q.add( 3 * coulomb(), 3 );
+    q.add( 4 * coulomb(), 3 );
+
+    REQUIRE( b( q.shard_total( 3 ) ) == "7.000000 s A" );
+    REQUIRE( b( q.total() ) == "10.000000 s A" );
+
+    q.reset();
+    REQUIRE( b( q.total() ) == "0.000000 s A" );
+
+    REQUIRE_THROWS_AS( sharded_accumulator< energy_d >( 0 ), quantity_error );
+}
+
+TEST_CASE( "sharded/thread", "Sharded accumulator add to the shard of the calling thread" )
+{
+    sharded_accumulator< electric_charge_d > q( 2 );
+    sharded_accumulator< electric_charge_d > r( 1 );
+
+    q.add( 1 * coulomb() );
+    r.add( 5 * coulomb() );
+    q.add( 2 * coulomb() );
+
+    REQUIRE( b( q.shard_total( 0 ) ) == "3.000000 s A" );
+    REQUIRE( b( q.shard_total( 1 ) ) == "0.000000 s A" );
+    REQUIRE( b( q.total() ) == "3.000000 s A" );
+    REQUIRE( b( r.total() ) == "5.000000 s A" );
+
+    q.reset();
+    q.add( 4 * coulomb() );
+
+    REQUIRE( b( q.shard_total( 0 ) ) == "4.000000 s A" );
+    REQUIRE( b( q.total() ) == "4.000000 s A" );
+}
+
+TEST_CASE( "sharded/compensated", "Sharded accumulator with Kahan compensation" )
+{
+    sharded_accumulator< energy_d, double, false > plain( 2 );
+    sharded_accumulator< energy_d, double, true  > kahan( 2 );
+
+    plain.add( 1 * joule(), 0 );
+    kahan.add( 1 * joule(), 0 );
+
+    for ( int i = 0; i < 1000; ++i )
+    {
+        plain.add( 1e-16 * joule(), i % 2 );
+        kahan.add( 1e-16 * joule(), i % 2 );
+    }
+
+    REQUIRE( plain.total() / joule() - 1 < 0.6e-13 );
+    REQUIRE( kahan.total() / joule() - 1 > 0.9e-13 );
+    REQUIRE( kahan.total() / joule() - 1 < 1.1e-13 );
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
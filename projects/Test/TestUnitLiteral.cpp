@@ -0,0 +1,80 @@
+/*
+ * TestUnitLiteral.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP20_OR_GREATER
+
+#include "phys/units/quantity_unit_literal.hpp"
+
+#include <type_traits>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::literals;
+#else
+using namespace phys::units;
+using namespace phys::units::literals;
+#endif
+
+// dimensions and types fixed at compile time
+
+static_assert( std::is_same< unit_dimensions< "m+2 kg s-3" >, power_d >::value, "symbol() grammar" );
+static_assert( std::is_same< unit_dimensions< "kN*m/s^2" >, dimensions< 2, 1, -4 > >::value, "operator grammar" );
+static_assert( std::is_same< unit_dimensions< "W/m^2/K" >, dimensions< 0, 1, -3, 0, -1 > >::value, "'/' applies to one term" );
+static_assert( std::is_same< unit_dimensions< "1/s" >, frequency_d >::value, "reciprocal" );
+static_assert( std::is_same< decltype( "m/m"_unit ), Rep >::value, "dimensionless collapses to Rep" );
+
+static_assert( "kN"_unit == "Mg m s-2"_unit, "prefix" );
+static_assert( "Pa"_unit == "N/m2"_unit, "symbol before prefix" );
+static_assert( detail::parse_unit( "h", 1 ).factor == 3600, "hour before hecto" );
+
+TEST_CASE( "unit literal/value", "Unit string literals have the value of the unit" )
+{
+    REQUIRE( b( "m+2 kg s-3"_unit ) == "1.000000 m+2 kg s-3" );
+    REQUIRE( b( "kN*m/s^2"_unit ) == "1000.000000 m+2 kg s-4" );
+    REQUIRE( b( "km/h"_unit ) == "0.277778 m s-1" );
+    REQUIRE( b( "mm^2"_unit ) == "0.000001 m+2" );
+    REQUIRE( b( "g cm-3"_unit ) == "1000.000000 m-3 kg" );
+
+    REQUIRE( "kOhm"_unit == kilo() * ohm() );
+    REQUIRE( "uF"_unit == micro() * farad() );
+    REQUIRE( "daN"_unit == 10 * newton() );
+    REQUIRE( "mol/dm^3"_unit == 1000 * mole() / cube( meter() ) );
+}
+
+TEST_CASE( "unit literal/conversion", "Unit string literals convert quantities" )
+{
+    quantity< speed_d > const v = 36 * "km/h"_unit;
+
+    REQUIRE( v / ( meter() / second() ) == Approx( 10 ) );
+    REQUIRE( v / "km/h"_unit == Approx( 36 ) );
+}
+
+TEST_CASE( "unit literal/parse", "The parser accepts the grammar and rejects malformed strings" )
+{
+    using ct::phys::units::detail::parse_unit;
+
+    REQUIRE( parse_unit( "s-1", 3 ).dim[2] == -1 );
+    REQUIRE( parse_unit( "m^+2", 4 ).dim[0] == 2 );
+    REQUIRE( parse_unit( "ms", 2 ).factor == Approx( 1e-3 ) );
+
+    REQUIRE_THROWS_AS( parse_unit( "", 0 ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit( "furlong", 7 ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit( "m^", 2 ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit( "m//s", 4 ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit( "(m)", 3 ), quantity_error );
+}
+
+#endif // PHYS_UNITS_CPP20_OR_GREATER
+
+/*
+ * end of file
+ */
@@ -0,0 +1,126 @@
+/*
+ * TestUnitParser.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+
+#include "phys/units/quantity_unit_parser.hpp"
+
+#include <thread>
+#include <vector>
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+#else
+using namespace phys::units;
+#endif
+
+TEST_CASE( "unit parser/dimensions", "Unit expressions have the dimensions of their units" )
+{
+    REQUIRE( has_dimensions< energy_d >( parse_unit_expression( "kW.h" ) ) );
+    REQUIRE( has_dimensions< energy_d >( parse_unit_expression( "N m" ) ) );
+    REQUIRE( has_dimensions< dimensions< 3, 0, -1 > >( parse_unit_expression( "m3/s" ) ) );
+    REQUIRE( has_dimensions< power_d >( parse_unit_expression( "m+2 kg s-3" ) ) );
+    REQUIRE( has_dimensions< frequency_d >( parse_unit_expression( "1/s" ) ) );
+    REQUIRE( has_dimensions< dimensionless_d >( parse_unit_expression( "rad" ) ) );
+    REQUIRE( has_dimensions< dimensions< 0, 1, -3, 0, -1 > >( parse_unit_expression( "W/m^2/K" ) ) );
+
+    REQUIRE_FALSE( has_dimensions< power_d >( parse_unit_expression( "kW.h" ) ) );
+}
+
+TEST_CASE( "unit parser/factor", "Unit expressions have the factor of their units" )
+{
+    REQUIRE( parse_unit_expression( "kW.h" ).factor == Approx( 3.6e6 ) );
+    REQUIRE( parse_unit_expression( "kWh" ).factor == Approx( 3.6e6 ) );
+    REQUIRE( parse_unit_expression( "km/h" ).factor == Approx( 1 / 3.6 ) );
+    REQUIRE( parse_unit_expression( "mm^2" ).factor == Approx( 1e-6 ) );
+    REQUIRE( parse_unit_expression( "g/cm3" ).factor == Approx( 1e3 ) );
+    REQUIRE( parse_unit_expression( "daN" ).factor == Approx( 10 ) );
+    REQUIRE( parse_unit_expression( "hPa" ).factor == Approx( 100 ) );
+    REQUIRE( parse_unit_expression( "\xC2\xB5s" ).factor == Approx( 1e-6 ) );
+    REQUIRE( parse_unit_expression( "L/min" ).factor == Approx( 1e-3 / 60 ) );
+
+    REQUIRE( make_quantity< speed_d >( 36, parse_unit_expression( "km/h" ) ) / ( meter() / second() ) == Approx( 10 ) );
+    REQUIRE_THROWS_AS( make_quantity< speed_d >( 36, parse_unit_expression( "km" ) ), quantity_error );
+}
+
+TEST_CASE( "unit parser/errors", "Malformed unit expressions throw" )
+{
+    REQUIRE_THROWS_AS( parse_unit_expression( "" ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit_expression( "furlong" ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit_expression( "xm" ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit_expression( "m^" ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit_expression( "m//s" ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit_expression( "m/" ), quantity_error );
+    REQUIRE_THROWS_AS( parse_unit_expression( "m200" ), quantity_error );
+}
+
+TEST_CASE( "unit parser/cache", "The cache returns the parse of each string" )
+{
+    unit_expression_cache cache( 16 );
+
+    REQUIRE( cache.lookup( "kW.h" ).factor == Approx( 3.6e6 ) );
+    REQUIRE( cache.lookup( "kW.h" ).factor == Approx( 3.6e6 ) );
+    REQUIRE( cache.lookup( "N m" ).code == dimension_code< energy_d >::value );
+    REQUIRE( cache.size() == 2 );
+
+    REQUIRE_THROWS_AS( cache.lookup( "furlong" ), quantity_error );
+    REQUIRE( cache.size() == 2 );
+
+    // past three quarters of the capacity, strings are parsed but not stored
+
+    char const * const units[] = { "m", "s", "A", "K", "mol", "cd", "Hz", "N", "Pa", "J", "W", "C", "V", "F" };
+
+    for ( char const * u : units )
+    {
+        cache.lookup( u );
+    }
+    REQUIRE( cache.size() == 12 );
+    REQUIRE( cache.lookup( "F" ).code == dimension_code< capacitance_d >::value );
+}
+
+TEST_CASE( "unit parser/cache threads", "Concurrent misses do not fill the cache past its limit" )
+{
+    char const * const units[] = { "m", "s", "A", "K", "mol", "cd", "Hz", "N", "Pa", "J", "W", "C", "V", "F", "Wb", "T" };
+
+    for ( int round = 0; round < 20; ++round )
+    {
+        unit_expression_cache cache( 16 );
+
+        std::vector< std::thread > threads;
+        for ( int t = 0; t < 8; ++t )
+        {
+            threads.push_back( std::thread( [&cache, &units, t]()
+            {
+                for ( int k = 0; k < 16; ++k )
+                {
+                    cache.lookup( units[ ( k + 2 * t ) % 16 ] );
+                }
+            } ) );
+        }
+        for ( std::thread & t : threads )
+        {
+            t.join();
+        }
+
+        REQUIRE( cache.size() == 12 );
+
+        // a miss ends at a free slot
+
+        REQUIRE( cache.lookup( "H" ).code == dimension_code< inductance_d >::value );
+    }
+}
+
+#endif // PHYS_UNITS_CPP11_OR_GREATER
+
+/*
+ * end of file
+ */
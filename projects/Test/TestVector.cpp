@@ -0,0 +1,139 @@
+/*
+ * TestVector.cpp
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TestUtil.hpp"
+
+#include "catch.hpp"
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_vector.hpp"
+
+#ifdef PHYS_UNITS_IN_CT_NAMESPACE
+using namespace ct::phys::units;
+using namespace ct::phys::units::io;
+#else
+using namespace phys::units;
+using namespace phys::units::io;
+#endif
+
+typedef quantity_vector< length_d > position;
+typedef quantity_vector< speed_d  > velocity;
+typedef quantity_vector< force_d  > force;
+
+TEST_CASE( "vector/construct", "Quantity vector construction and access" )
+{
+    position r( 1 * meter(), 2 * meter(), 3 * meter() );
+
+    REQUIRE( b( r[0] ) == "1.000000 m" );
+    REQUIRE( b( r[1] ) == "2.000000 m" );
+    REQUIRE( b( r[2] ) == "3.000000 m" );
+
+    r.set( 1, 5 * meter() );
+    REQUIRE( b( r[1] ) == "5.000000 m" );
+
+    REQUIRE( b( position::zero()[2] ) == "0.000000 m" );
+
+    quantity_vector< length_d, double, 2 > p( 1 * meter(), 2 * meter() );
+    REQUIRE( b( p[1] ) == "2.000000 m" );
+}
+
+TEST_CASE( "vector/arithmetic", "Quantity vector arithmetic" )
+{
+    position a( 1 * meter(), 2 * meter(), 3 * meter() );
+    position c( 4 * meter(), 5 * meter(), 6 * meter() );
+
+    REQUIRE( ( a + c ) == position( 5 * meter(), 7 * meter(), 9 * meter() ) );
+    REQUIRE( ( c - a ) == position( 3 * meter(), 3 * meter(), 3 * meter() ) );
+    REQUIRE( ( -a ) == position( -1 * meter(), -2 * meter(), -3 * meter() ) );
+    REQUIRE( ( 2 * a ) == position( 2 * meter(), 4 * meter(), 6 * meter() ) );
+    REQUIRE( ( a * 2 ) == ( 2 * a ) );
+    REQUIRE( ( a / 2 ) == position( 0.5 * meter(), 1 * meter(), 1.5 * meter() ) );
+    REQUIRE( ( a != c ) == true );
+
+    a += c;
+    REQUIRE( a == position( 5 * meter(), 7 * meter(), 9 * meter() ) );
+    a -= c;
+    a *= 3;
+    REQUIRE( a == position( 3 * meter(), 6 * meter(), 9 * meter() ) );
+    a /= 3;
+    REQUIRE( a == position( 1 * meter(), 2 * meter(), 3 * meter() ) );
+}
+
+TEST_CASE( "vector/scale", "Quantity vector scaling by quantities" )
+{
+    velocity v( 1 * meter() / second(), 2 * meter() / second(), 0 * meter() / second() );
+
+    position dx = v * ( 2 * second() );
+    REQUIRE( dx == position( 2 * meter(), 4 * meter(), 0 * meter() ) );
+    REQUIRE( ( ( 2 * second() ) * v ) == dx );
+    REQUIRE( ( dx / ( 2 * second() ) ) == v );
+
+    // dimensionless result collapses to the representation type:
+
+    quantity_vector< dimensionless_d > u = dx / meter();
+    REQUIRE( s( u[1] ) == "4.000000" );
+}
+
+TEST_CASE( "vector/product", "Quantity vector dot and cross product" )
+{
+    position r( 2 * meter(), 0 * meter(), 0 * meter() );
+    force    F( 0 * newton(), 3 * newton(), 4 * newton() );
+    force    G( 1 * newton(), 1 * newton(), 0 * newton() );
+
+    REQUIRE( b( dot( r, G ) ) == "2.000000 m+2 kg s-2" );
+    REQUIRE( b( dot( r, F ) ) == "0.000000 m+2 kg s-2" );
+    REQUIRE( s( dot( r, r ) / ( meter() * meter() ) ) == "4.000000" );
+
+    quantity_vector< torque_d > tau = cross( r, F );
+    REQUIRE( b( tau[0] ) == "0.000000 m+2 kg s-2" );
+    REQUIRE( b( tau[1] ) == "-8.000000 m+2 kg s-2" );
+    REQUIRE( b( tau[2] ) == "6.000000 m+2 kg s-2" );
+
+    // dimensionless dot product collapses to the representation type:
+
+    quantity_vector< dimensionless_d > u = r / meter();
+    REQUIRE( s( dot( u, u ) ) == "4.000000" );
+}
+
+TEST_CASE( "vector/norm", "Quantity vector Euclidean length" )
+{
+    REQUIRE( b( norm( position( 3 * meter(), 0 * meter(), 4 * meter() ) ) ) == "5.000000 m" );
+    REQUIRE( b( norm( force( 2 * newton(), 3 * newton(), 6 * newton() ) ) ) == "7.000000 m kg s-2" );
+}
+
+TEST_CASE( "vector/array", "Quantity vector array, structure of arrays" )
+{
+    quantity_vector_array< length_d > x( 3 );
+    quantity_vector_array< speed_d  > v( 3 );
+
+    for ( int i = 0; i < 3; ++i )
+    {
+        x.set( i, position( i * meter(), 0 * meter(), 0 * meter() ) );
+        v.set( i, velocity( 1 * meter() / second(), i * meter() / second(), 2 * meter() / second() ) );
+    }
+
+    x.add_scaled( v, 0.5 * second() );
+
+    REQUIRE( x.size() == 3u );
+    REQUIRE( x[0] == position( 0.5 * meter(), 0.0 * meter(), 1 * meter() ) );
+    REQUIRE( x[2] == position( 2.5 * meter(), 1.0 * meter(), 1 * meter() ) );
+}
+
+TEST_CASE( "vector/exception", "Quantity vector exceptions" )
+{
+    quantity_vector_array< length_d > x( 3 );
+    quantity_vector_array< speed_d  > v( 2 );
+
+    REQUIRE_THROWS_AS( x.add_scaled( v, second() ), quantity_error );
+
+// scaled vectors must have the dimensions of the target:
+// uncomment next lines for compile-time error:
+//    x.add_scaled( x, second() );
+}
+
+/*
+ * end of file
+ */
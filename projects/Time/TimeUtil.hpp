@@ -0,0 +1,76 @@
+/*
+ * TimeUtil.hpp
+ *
+ * Timing support for the performance programs in this folder.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef TIMEUTIL_H_INCLUDED
+#define TIMEUTIL_H_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+# include <chrono>
+#else
+# include <time.h>
+#endif
+
+/**
+ * wall-clock stopwatch; falls back to clock() for pre-C++11 compilers.
+ */
+class stopwatch
+{
+public:
+    stopwatch()
+    {
+        restart();
+    }
+
+    void restart()
+    {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+        m_start = std::chrono::steady_clock::now();
+#else
+        m_start = clock();
+#endif
+    }
+
+    /**
+     * seconds since construction or last restart().
+     */
+    double elapsed() const
+    {
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+        return std::chrono::duration<double>( std::chrono::steady_clock::now() - m_start ).count();
+#else
+        return double( clock() - m_start ) / CLOCKS_PER_SEC;
+#endif
+    }
+
+private:
+#ifdef PHYS_UNITS_CPP11_OR_GREATER
+    std::chrono::steady_clock::time_point m_start;
+#else
+    clock_t m_start;
+#endif
+};
+
+/**
+ * keep the optimizer from discarding a result.
+ */
+template< typename T >
+inline void keep( T const & value )
+{
+    static char volatile sink;
+    sink = *reinterpret_cast< char const volatile * >( &value );
+    (void) sink;
+}
+
+#endif // TIMEUTIL_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,111 @@
+/*
+ * atomic.cpp
+ *
+ * Contended accumulation into one shared energy total from 1 to 64 threads,
+ * for:
+ * - atomic_quantity< energy_d >::fetch_add(),
+ * - std::atomic<double> with a compare-exchange loop,
+ * - quantity< energy_d > protected by a std::mutex.
+ *
+ * Requires C++11; link with -pthread.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_atomic.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace phys::units;
+
+const int n = 1 << 21;   // additions per run, divided over the threads
+
+template< typename Work >
+double run( int const threads, Work work )
+{
+    std::vector< std::thread > pool;
+    stopwatch sw;
+
+    for ( int t = 0; t < threads; ++t )
+    {
+        pool.push_back( std::thread( work, n / threads ) );
+    }
+    for ( int t = 0; t < threads; ++t )
+    {
+        pool[t].join();
+    }
+    return sw.elapsed();
+}
+
+void check( double const total, char const * const text )
+{
+    if ( total != n * 0.5 )
+    {
+        std::cerr << text << ": lost updates, total " << total << ", expected " << n * 0.5 << std::endl;
+        std::exit( EXIT_FAILURE );
+    }
+}
+
+int main()
+{
+    std::cout << "Shared accumulation, " << n << " additions, ns/addition (total of all threads)." << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "atomic_q" << std::setw(12) << "atomic<d>" << std::setw(12) << "mutex" << std::endl;
+
+    for ( int threads = 1; threads <= 64; threads *= 2 )
+    {
+        atomic_quantity< energy_d > aq;
+
+        double const t1 = run( threads, [&aq]( int const count )
+        {
+            for ( int i = 0; i < count; ++i )
+            {
+                aq.fetch_add( 0.5 * joule(), std::memory_order_relaxed );
+            }
+        } );
+        check( aq.load() / joule(), "atomic_quantity" );
+
+        std::atomic< double > ad( 0 );
+
+        double const t2 = run( threads, [&ad]( int const count )
+        {
+            for ( int i = 0; i < count; ++i )
+            {
+                double old = ad.load( std::memory_order_relaxed );
+                while ( ! ad.compare_exchange_weak( old, old + 0.5, std::memory_order_relaxed ) )
+                {
+                }
+            }
+        } );
+        check( ad.load(), "atomic<double>" );
+
+        quantity< energy_d > mq( 0 * joule() );
+        std::mutex mutex;
+
+        double const t3 = run( threads, [&mq, &mutex]( int const count )
+        {
+            for ( int i = 0; i < count; ++i )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                mq += 0.5 * joule();
+            }
+        } );
+        check( mq / joule(), "mutex" );
+
+        std::cout << std::setw(8) << threads <<
+            std::setw(12) << 1e9 * t1 / n << std::setw(12) << 1e9 * t2 / n << std::setw(12) << 1e9 * t3 / n << std::endl;
+    }
+}
+
+/*
+ * end of file
+ */
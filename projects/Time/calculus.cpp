@@ -0,0 +1,152 @@
+/*
+ * calculus.cpp
+ *
+ * Throughput of integration and differentiation of sampled series,
+ * power over time to energy, position over time to speed, for:
+ * - loops over plain doubles,
+ * - trapezoid(), simpson(), cumulative_trapezoid(), derivative() on quantities.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_calculus.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 4000000;    // samples
+const int reps = 20;
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e-6 * double( n ) * reps / seconds << " Msamples/s" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Integration and differentiation, " << n << " samples x " << reps << " repetitions." << std::endl;
+
+    const double dt = 1e-3;
+
+    std::vector<double> dtime( n ), dpower( n ), dout( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        dtime[i]  = i * dt;
+        dpower[i] = 1.0 + std::sin( 1e-3 * i );
+    }
+
+    std::vector< quantity<time_interval_d> > qtime( n );
+    std::vector< quantity<power_d> > qpower( n );
+    std::vector< quantity<energy_d> > qenergy( n );
+    std::vector< quantity<dimensions<2,1,-4> > > qrate( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        qtime[i]  = dtime[i] * second();
+        qpower[i] = dpower[i] * watt();
+    }
+
+    const quantity<time_interval_d> qdt = dt * second();
+
+    // trapezoid
+
+    stopwatch sw;
+    for ( int k = 0; k < reps; ++k )
+    {
+        double sum = 0;
+        for ( int i = 0; i < n - 1; ++i )
+        {
+            sum += 0.5 * ( dpower[i] + dpower[i + 1] ) * ( dtime[i + 1] - dtime[i] );
+        }
+        keep( sum );
+    }
+    report( "double   trapezoid:  ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        keep( trapezoid( &qpower[0], &qtime[0], n ) );
+    }
+    report( "quantity trapezoid:  ", sw.elapsed() );
+
+    // simpson, uniform spacing
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        double sum = dpower[0] + dpower[n - 1];
+        for ( int i = 1; i < n - 1; ++i )
+        {
+            sum += ( i % 2 ? 4 : 2 ) * dpower[i];
+        }
+        keep( sum * dt / 3 );
+    }
+    report( "double   simpson:    ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        keep( simpson( &qpower[0], n - 1 + n % 2, qdt ) );
+    }
+    report( "quantity simpson:    ", sw.elapsed() );
+
+    // cumulative
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        dout[0] = 0;
+        for ( int i = 0; i < n - 1; ++i )
+        {
+            dout[i + 1] = dout[i] + 0.5 * ( dpower[i] + dpower[i + 1] ) * ( dtime[i + 1] - dtime[i] );
+        }
+        keep( dout[n - 1] );
+    }
+    report( "double   cumulative: ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        cumulative_trapezoid( &qpower[0], &qtime[0], n, &qenergy[0] );
+        keep( qenergy[n - 1] );
+    }
+    report( "quantity cumulative: ", sw.elapsed() );
+
+    // derivative, uniform spacing
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        const double h = 0.5 / dt;
+        for ( int i = 1; i < n - 1; ++i )
+        {
+            dout[i] = h * ( dpower[i + 1] - dpower[i - 1] );
+        }
+        dout[0]     = h * ( -3 * dpower[0] + 4 * dpower[1] - dpower[2] );
+        dout[n - 1] = h * ( 3 * dpower[n - 1] - 4 * dpower[n - 2] + dpower[n - 3] );
+        keep( dout[n / 2] );
+    }
+    report( "double   derivative: ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        derivative( &qpower[0], n, qdt, &qrate[0] );
+        keep( qrate[n / 2] );
+    }
+    report( "quantity derivative: ", sw.elapsed() );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
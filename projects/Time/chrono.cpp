@@ -0,0 +1,122 @@
+/*
+ * chrono.cpp
+ *
+ * Conversion of std::chrono durations to time quantities and back, for:
+ * - count() times a factor written by hand,
+ * - to_quantity() and to_duration().
+ *
+ * The conversions of convert-*() are listed as assembly by 'make chrono-asm':
+ * each is one multiplication, with the conversion of the tick type, or nothing.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_chrono.hpp"
+
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 100000;   // durations
+const int reps = 1000;     // n * reps conversions
+
+typedef std::chrono::duration< double, std::micro > double_us;
+
+quantity< time_interval_d > convert_from_ns( std::chrono::nanoseconds const d )
+{
+    return to_quantity( d );
+}
+
+quantity< time_interval_d > convert_from_double_s( std::chrono::duration< double > const d )
+{
+    return to_quantity( d );
+}
+
+quantity< time_interval_d, std::chrono::minutes::rep > convert_from_min( std::chrono::minutes const d )
+{
+    return to_quantity( d );
+}
+
+double_us convert_to_double_us( quantity< time_interval_d > const q )
+{
+    return as_duration( q );
+}
+
+std::chrono::microseconds convert_to_us( quantity< time_interval_d > const q )
+{
+    return to_duration< std::chrono::microseconds >( q );
+}
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * reps ) << " ns/conversion" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Duration to quantity and back, " << double( n ) * reps << " conversions." << std::endl;
+
+    std::vector< std::chrono::nanoseconds > d( n );
+    std::vector< quantity< time_interval_d > > q( n );
+    std::vector< double_us > us( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        d[i] = std::chrono::nanoseconds( 1000000 + 37 * i );
+    }
+
+    stopwatch sw;
+    for ( int r = 0; r < reps; ++r )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            q[i] = ( double( d[i].count() ) * 1e-9 ) * second();
+        }
+        keep( q[n / 2] );
+    }
+    report( "count() * 1e-9 * second(): ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            q[i] = to_quantity( d[i] );
+        }
+        keep( q[n / 2] );
+    }
+    report( "to_quantity():             ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            us[i] = double_us( q[i] / second() * 1e6 );
+        }
+        keep( us[n / 2] );
+    }
+    report( "q / second() * 1e6:        ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            us[i] = as_duration( q[i] );
+        }
+        keep( us[n / 2] );
+    }
+    report( "as_duration():             ", sw.elapsed() );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
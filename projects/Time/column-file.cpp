@@ -0,0 +1,168 @@
+/*
+ * column-file.cpp
+ *
+ * Loading multichannel telemetry, for:
+ * - a CSV file, read and parsed with strtod(),
+ * - a column file, memory-mapped with zero-copy column views,
+ * - a column file, copied into vectors with copy_column().
+ *
+ * The files are written once and read repeatedly, so they come from the
+ * page cache; each load touches every value by summing the columns. Rates
+ * are for the binary payload, 8 bytes per value.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_column_file.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace phys::units;
+
+const int channels = 8;
+const int rows     = 1000000;
+const int reps     = 5;
+
+char const * const binary_path = "column-file.col";
+char const * const csv_path    = "column-file.csv";
+
+void report( char const * const text, double const seconds )
+{
+    double const bytes = double( channels ) * rows * sizeof( Rep ) * reps;
+
+    std::cout << text << bytes / seconds / 1e9 << " GB/s" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Telemetry load, " << channels << " channels x " << rows << " rows of "
+              << sizeof( Rep ) << "-byte values, " << reps << " repetitions." << std::endl;
+
+    std::vector< std::vector< quantity< electric_potential_d > > > data( channels );
+
+    std::srand( 42 );
+    for ( int c = 0; c < channels; ++c )
+    {
+        data[c].resize( rows );
+        for ( int i = 0; i < rows; ++i )
+        {
+            data[c][i] = ( 230 + 10.0 * std::rand() / RAND_MAX ) * volt();
+        }
+    }
+
+    {
+        column_file_writer w;
+        for ( int c = 0; c < channels; ++c )
+        {
+            std::ostringstream name;
+            name << "u" << c;
+            w.add( name.str(), &data[c][0], rows );
+        }
+        w.write( binary_path );
+
+        std::ofstream os( csv_path );
+        os.precision( 17 );
+        for ( int i = 0; i < rows; ++i )
+        {
+            for ( int c = 0; c < channels; ++c )
+            {
+                os << ( c ? "," : "" ) << data[c][i] / volt();
+            }
+            os << "\n";
+        }
+    }
+
+    stopwatch sw;
+    for ( int r = 0; r < reps; ++r )
+    {
+        std::ifstream is( csv_path, std::ios::binary | std::ios::ate );
+        std::string text( static_cast< std::size_t >( is.tellg() ), '\0' );
+        is.seekg( 0 );
+        is.read( &text[0], static_cast< std::streamsize >( text.size() ) );
+
+        std::vector< std::vector< quantity< electric_potential_d > > > columns( channels );
+        for ( int c = 0; c < channels; ++c )
+        {
+            columns[c].reserve( rows );
+        }
+
+        char const * p = text.c_str();
+        for ( int i = 0; i < rows; ++i )
+        {
+            for ( int c = 0; c < channels; ++c )
+            {
+                char * end;
+                columns[c].push_back( std::strtod( p, &end ) * volt() );
+                p = end + 1;
+            }
+        }
+
+        quantity< electric_potential_d > sum = 0 * volt();
+        for ( int c = 0; c < channels; ++c )
+        {
+            for ( int i = 0; i < rows; ++i )
+            {
+                sum += columns[c][i];
+            }
+        }
+        keep( sum );
+    }
+    report( "CSV strtod:          ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        column_file f( binary_path );
+
+        quantity< electric_potential_d > sum = 0 * volt();
+        for ( std::size_t c = 0; c < f.size(); ++c )
+        {
+            column_view< electric_potential_d > u = f.column< electric_potential_d >( c );
+
+            for ( std::size_t i = 0; i < u.size(); ++i )
+            {
+                sum += u[i];
+            }
+        }
+        keep( sum );
+    }
+    report( "column file view:    ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        column_file f( binary_path );
+
+        quantity< electric_potential_d > sum = 0 * volt();
+        for ( std::size_t c = 0; c < f.size(); ++c )
+        {
+            std::vector< quantity< electric_potential_d > > u = f.copy_column< electric_potential_d >( c );
+
+            for ( std::size_t i = 0; i < u.size(); ++i )
+            {
+                sum += u[i];
+            }
+        }
+        keep( sum );
+    }
+    report( "column file copy:    ", sw.elapsed() );
+
+    std::remove( binary_path );
+    std::remove( csv_path );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
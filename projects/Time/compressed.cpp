@@ -0,0 +1,133 @@
+/*
+ * compressed.cpp
+ *
+ * Compression of historian time series with compressed_series, for:
+ * - a temperature, sampled every second, random walk in steps of 0.1 K,
+ * - a pressure, sampled every 100 ms with jitter, random walk in steps of 1 Pa,
+ * - a range query for 1% of the temperature series.
+ *
+ * Rates are for the uncompressed samples, 16 bytes per sample: an 8-byte
+ * timestamp and an 8-byte value.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_compressed.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 4000000;   // samples
+const int reps = 5;
+
+template< typename Dims >
+void measure( char const * const name, std::vector< std::int64_t > const & times, std::vector< quantity< Dims > > const & values )
+{
+    double const bytes = 16.0 * n * reps;
+
+    stopwatch sw;
+    for ( int r = 0; r < reps; ++r )
+    {
+        compressed_series< Dims > s;
+        for ( int i = 0; i < n; ++i )
+        {
+            s.append( times[i], values[i] );
+        }
+        keep( s.bytes() );
+    }
+    double const compress = sw.elapsed();
+
+    compressed_series< Dims > s;
+    for ( int i = 0; i < n; ++i )
+    {
+        s.append( times[i], values[i] );
+    }
+
+    std::vector< std::int64_t > t;
+    std::vector< quantity< Dims > > v;
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        t.clear();
+        v.clear();
+        s.decode( t, v );
+        keep( t.back() );
+    }
+    double const decompress = sw.elapsed();
+
+    std::cout << name << ": " << 16.0 * n / s.bytes() << " x, " << 8.0 * s.bytes() / n << " bits/sample, "
+              << "compress " << bytes / compress / 1e9 << " GB/s, "
+              << "decompress " << bytes / decompress / 1e9 << " GB/s" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Historian series, " << n << " samples, " << reps << " repetitions." << std::endl;
+
+    std::srand( 42 );
+
+    std::vector< std::int64_t > times( n );
+    std::vector< quantity< thermodynamic_temperature_d > > temperatures( n );
+
+    double k = 2931;   // 0.1 K
+    for ( int i = 0; i < n; ++i )
+    {
+        times[i] = 1700000000000LL + 1000LL * i;   // ms
+        k += std::rand() % 5 == 0 ? std::rand() % 3 - 1 : 0;
+        temperatures[i] = k / 10 * kelvin();
+    }
+
+    measure( "temperature", times, temperatures );
+
+    std::vector< std::int64_t > jittered( n );
+    std::vector< quantity< pressure_d > > pressures( n );
+
+    double p = 101325;
+    for ( int i = 0; i < n; ++i )
+    {
+        jittered[i] = 1700000000000LL + 100LL * i + std::rand() % 3;
+        p += std::rand() % 3 - 1;
+        pressures[i] = p * pascal();
+    }
+
+    measure( "pressure   ", jittered, pressures );
+
+    compressed_series< thermodynamic_temperature_d > s;
+    for ( int i = 0; i < n; ++i )
+    {
+        s.append( times[i], temperatures[i] );
+    }
+
+    std::vector< std::int64_t > t;
+    std::vector< quantity< thermodynamic_temperature_d > > v;
+
+    const int queries = 1000;
+
+    stopwatch sw;
+    for ( int q = 0; q < queries; ++q )
+    {
+        std::int64_t const t0 = times[ std::rand() % ( n - n / 100 ) ];
+
+        t.clear();
+        v.clear();
+        keep( s.decode( t0, t0 + 1000LL * ( n / 100 ), t, v ) );
+    }
+    std::cout << "range query, 1% of " << s.block_count() << " blocks: "
+              << 1e6 * sw.elapsed() / queries << " us/query" << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,156 @@
+/*
+ * csv.cpp
+ *
+ * Reading and writing multichannel CSV with unit headers, for:
+ * - std::getline() and strtod() per field, the baseline,
+ * - csv_reader with 1, 2 and 4 parse threads,
+ * - csv_writer.
+ *
+ * The file has a time column and 8 voltage columns in mV, written once and
+ * read from the page cache. Rates are for the CSV text.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_csv.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace phys::units;
+
+const int channels = 8;
+const int rows     = 1000000;
+const int reps     = 3;
+
+char const * const path = "csv.csv";
+
+double file_size()
+{
+    std::ifstream is( path, std::ios::binary | std::ios::ate );
+    return double( is.tellg() );
+}
+
+void report( char const * const text, double const seconds, double const bytes )
+{
+    std::cout << text << bytes * reps / seconds / 1e9 << " GB/s" << std::endl;
+}
+
+int main()
+{
+    std::cout << "CSV, time and " << channels << " voltage columns, " << rows << " rows, "
+              << reps << " repetitions." << std::endl;
+
+    std::vector< quantity< time_interval_d > > time( rows );
+    std::vector< std::vector< quantity< electric_potential_d > > > u( channels, std::vector< quantity< electric_potential_d > >( rows ) );
+
+    std::srand( 42 );
+    for ( int i = 0; i < rows; ++i )
+    {
+        time[i] = i * 1e-3 * second();
+        for ( int c = 0; c < channels; ++c )
+        {
+            u[c][i] = std::floor( 1e4 * std::rand() / RAND_MAX ) * 1e-3 * milli() * volt();   // 0.001 mV resolution
+        }
+    }
+
+    std::vector< std::string > names( channels );
+    for ( int c = 0; c < channels; ++c )
+    {
+        std::ostringstream os;
+        os << "u" << c;
+        names[c] = os.str();
+    }
+
+    stopwatch sw;
+    for ( int r = 0; r < reps; ++r )
+    {
+        csv_writer w;
+        w.add( "time", &time[0], rows );
+        for ( int c = 0; c < channels; ++c )
+        {
+            w.add( names[c], &u[c][0], rows, "mV" );
+        }
+        std::ofstream os( path, std::ios::binary );
+        w.write( os );
+    }
+    double const elapsed = sw.elapsed();
+    double const bytes = file_size();
+
+    std::cout << "file size: " << bytes / 1e6 << " MB" << std::endl;
+    report( "csv_writer:             ", elapsed, bytes );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        std::ifstream is( path, std::ios::binary );
+        std::string line;
+        std::getline( is, line );
+
+        std::vector< std::vector< double > > columns( channels + 1 );
+        while ( std::getline( is, line ) )
+        {
+            char const * p = line.c_str();
+            for ( int c = 0; c <= channels; ++c )
+            {
+                char * end;
+                columns[c].push_back( std::strtod( p, &end ) );
+                p = end + 1;
+            }
+        }
+        keep( columns[channels].back() );
+    }
+    report( "getline and strtod:     ", sw.elapsed(), bytes );
+
+    for ( unsigned threads = 1; threads <= 4; threads *= 2 )
+    {
+        sw.restart();
+        for ( int r = 0; r < reps; ++r )
+        {
+            std::ifstream is( path, std::ios::binary );
+            csv_reader reader( is, ',', threads );
+
+            std::vector< quantity< time_interval_d > > t;
+            std::vector< std::vector< quantity< electric_potential_d > > > v( channels );
+
+            reader.bind( "time", t );
+            for ( int c = 0; c < channels; ++c )
+            {
+                reader.bind( names[c], v[c] );
+            }
+
+            quantity< electric_potential_d > sum = 0 * volt();
+            while ( std::size_t const n = reader.read() )
+            {
+                for ( int c = 0; c < channels; ++c )
+                {
+                    for ( std::size_t i = 0; i < n; ++i )
+                    {
+                        sum += v[c][i];
+                    }
+                }
+            }
+            keep( sum );
+        }
+        std::cout << "csv_reader, " << threads << " thread" << ( threads > 1 ? "s: " : ":  " );
+        report( "", sw.elapsed(), bytes );
+    }
+
+    std::remove( path );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
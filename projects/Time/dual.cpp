@@ -0,0 +1,115 @@
+/*
+ * dual.cpp
+ *
+ * Gradient of a five-input energy model with respect to all inputs, for:
+ * - central finite differences, 10 evaluations on quantity< Dims >,
+ * - one evaluation on quantity< Dims, dual< Rep, 5 > >.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_dual.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 100000;   // model points
+const int reps = 20;       // n * reps gradients
+
+typedef dual< Rep, 5 > d5;
+
+typedef dimensions< 0, 1, -2 > stiffness_d;
+
+/**
+ * kinetic, potential and spring energy plus a sqrt coupling term.
+ */
+template< typename T >
+quantity< energy_d, T > model(
+    quantity< mass_d, T > const & m, quantity< speed_d, T > const & v, quantity< length_d, T > const & h,
+    quantity< stiffness_d, T > const & k, quantity< length_d, T > const & x )
+{
+    const quantity< acceleration_d > g = 9.81 * meter() / second() / second();
+
+    return 0.5 * m * v * v + m * g * h + 0.5 * k * x * x + 0.1 * m * v * sqrt( g * h );
+}
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * reps ) << " ns/gradient" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Gradient of a model with 5 inputs, " << double( n ) * reps << " gradients." << std::endl;
+
+    std::vector< quantity<mass_d> > m( n );
+    std::vector< quantity<speed_d> > v( n );
+    std::vector< quantity<length_d> > h( n ), x( n );
+    std::vector< quantity<stiffness_d> > k( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        m[i] = ( 1.0 + 1e-5 * i ) * kilogram();
+        v[i] = ( 3.0 + 2e-5 * i ) * meter() / second();
+        h[i] = ( 10.0 - 5e-5 * i ) * meter();
+        k[i] = ( 200.0 + 1e-3 * i ) * kilogram() / second() / second();
+        x[i] = ( 0.1 + 1e-6 * i ) * meter();
+    }
+
+    std::vector< double > gfd( 5 * n ), gad( 5 * n );
+
+    stopwatch sw;
+    for ( int r = 0; r < reps; ++r )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            const double e = 1e-6;   // relative step
+
+            gfd[5*i+0] = ( model( m[i] * ( 1 + e ), v[i], h[i], k[i], x[i] ) - model( m[i] * ( 1 - e ), v[i], h[i], k[i], x[i] ) ) / ( 2 * e * m[i] ) * kilogram() / joule();
+            gfd[5*i+1] = ( model( m[i], v[i] * ( 1 + e ), h[i], k[i], x[i] ) - model( m[i], v[i] * ( 1 - e ), h[i], k[i], x[i] ) ) / ( 2 * e * v[i] ) * meter() / second() / joule();
+            gfd[5*i+2] = ( model( m[i], v[i], h[i] * ( 1 + e ), k[i], x[i] ) - model( m[i], v[i], h[i] * ( 1 - e ), k[i], x[i] ) ) / ( 2 * e * h[i] ) * meter() / joule();
+            gfd[5*i+3] = ( model( m[i], v[i], h[i], k[i] * ( 1 + e ), x[i] ) - model( m[i], v[i], h[i], k[i] * ( 1 - e ), x[i] ) ) / ( 2 * e * k[i] ) * kilogram() / second() / second() / joule();
+            gfd[5*i+4] = ( model( m[i], v[i], h[i], k[i], x[i] * ( 1 + e ) ) - model( m[i], v[i], h[i], k[i], x[i] * ( 1 - e ) ) ) / ( 2 * e * x[i] ) * meter() / joule();
+        }
+        keep( gfd[n / 2] );
+    }
+    report( "finite differences: ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            const quantity< energy_d, d5 > y = model(
+                seed<5>( m[i], 0 ), seed<5>( v[i], 1 ), seed<5>( h[i], 2 ), seed<5>( k[i], 3 ), seed<5>( x[i], 4 ) );
+
+            gad[5*i+0] = derivative< mass_d >( y, 0 ) * kilogram() / joule();
+            gad[5*i+1] = derivative< speed_d >( y, 1 ) * meter() / second() / joule();
+            gad[5*i+2] = derivative< length_d >( y, 2 ) * meter() / joule();
+            gad[5*i+3] = derivative< stiffness_d >( y, 3 ) * kilogram() / second() / second() / joule();
+            gad[5*i+4] = derivative< length_d >( y, 4 ) * meter() / joule();
+        }
+        keep( gad[n / 2] );
+    }
+    report( "dual< Rep, 5 >:     ", sw.elapsed() );
+
+    double err = 0;
+    for ( int i = 0; i < 5 * n; ++i )
+    {
+        err = std::max( err, std::fabs( gfd[i] - gad[i] ) / std::fabs( gad[i] ) );
+    }
+    std::cout << "largest relative difference: " << err << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
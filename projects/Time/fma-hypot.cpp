@@ -0,0 +1,109 @@
+/*
+ * fma-hypot.cpp
+ *
+ * Throughput of x0 + v * t and sqrt( x*x + y*y ) versus fma() and hypot(),
+ * for plain double and for quantity.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n      = 4096;   // elements per pass, fits in L1/L2
+const int passes = 20000;
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * passes ) << " ns/element" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Throughput of fma() and hypot(), " << n << " x " << passes << " elements." << std::endl;
+
+    std::vector<double> dx0( n ), dv( n ), dx( n );
+    std::vector< quantity<length_d> > qx0( n ), qx( n ), qy( n );
+    std::vector< quantity<speed_d> > qv( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        dx0[i] = 0.001 * i;
+        dv [i] = 1.0 + 0.0001 * i;
+        qx0[i] = dx0[i] * meter();
+        qv [i] = dv [i] * meter() / second();
+        qy [i] = ( n - i ) * meter();
+    }
+
+    const double dt = 1e-3;
+    const quantity<time_interval_d> qt = dt * second();
+
+    stopwatch sw;
+
+    for ( int k = 0; k < passes; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+            dx[i] = dx0[i] + dv[i] * dt;
+        keep( dx[k % n] );
+    }
+    report( "double   x0 + v * t:          ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < passes; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+            dx[i] = std::fma( dv[i], dt, dx0[i] );
+        keep( dx[k % n] );
+    }
+    report( "double   fma( v, t, x0 ):     ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < passes; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+            qx[i] = qx0[i] + qv[i] * qt;
+        keep( qx[k % n] );
+    }
+    report( "quantity x0 + v * t:          ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < passes; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+            qx[i] = fma( qv[i], qt, qx0[i] );
+        keep( qx[k % n] );
+    }
+    report( "quantity fma( v, t, x0 ):     ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < passes; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+            qx[i] = sqrt( square( qx0[i] ) + square( qy[i] ) );
+        keep( qx[k % n] );
+    }
+    report( "quantity sqrt( x*x + y*y ):   ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < passes; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+            qx[i] = hypot( qx0[i], qy[i] );
+        keep( qx[k % n] );
+    }
+    report( "quantity hypot( x, y ):       ", sw.elapsed() );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
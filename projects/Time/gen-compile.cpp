@@ -0,0 +1,175 @@
+/*
+ * gen-compile.cpp
+ *
+ * Generate a translation unit for the compile-time benchmark:
+ *
+ *    gen-compile ndims nchains [mode] > compile-ndims-nchains.cpp
+ *
+ * The translation unit declares ndims distinct dimensions built from the
+ * base units, and nchains functions that multiply and divide quantities of
+ * those dimensions. Each chain instantiates product, quotient and collapse
+ * types. The mode selects how the library is obtained:
+ *
+ * - (none):  include io.hpp, chains write their results to a stream,
+ * - fwd:     include quantity_io_fwd.hpp only, chains write to a stream
+ *            (compiles, but does not link without instantiations),
+ * - include: include the headers of pch-units.hpp, chains return their result,
+ * - pch:     include pch-units.hpp, to be precompiled, chains return their result,
+ * - module:  import phys.units, chains return their result.
+ *
+ * The last three need C++14 and are used by target build-time, the first
+ * two by target compile-time in Makefile.win32.gcc.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+const int base_dims = 7;
+const int operands  = 4;    // quantities per chain
+
+char const * const base_unit[base_dims] =
+{
+    "meter()", "kilogram()", "second()", "ampere()", "kelvin()", "mole()", "candela()",
+};
+
+// exponents in [-2, 2] from the base-5 digits of index + 1, small exponents
+// first; distinct per index and never all zero
+
+void exponents( int const index, int exp[base_dims] )
+{
+    int const digit[5] = { 0, 1, -1, 2, -2 };
+
+    int code = index + 1;
+
+    for ( int k = 0; k < base_dims; ++k, code /= 5 )
+    {
+        exp[k] = digit[ code % 5 ];
+    }
+}
+
+void dimension( std::ostream & os, int const index )
+{
+    int exp[base_dims];
+    exponents( index, exp );
+
+    os << "typedef dimensions<";
+    for ( int k = 0; k < base_dims; ++k )
+    {
+        os << ( k ? ", " : " " ) << exp[k];
+    }
+    os << " > d" << index << ";\n";
+
+    os << "inline quantity< d" << index << " > q" << index << "( Rep v ) { return v";
+    for ( int k = 0; k < base_dims; ++k )
+    {
+        for ( int i = 0; i < std::abs( exp[k] ); ++i )
+        {
+            os << ( exp[k] > 0 ? " * " : " / " ) << base_unit[k];
+        }
+    }
+    os << "; }\n\n";
+}
+
+void chain( std::ostream & os, int const index, int const ndims, bool const stream )
+{
+    if ( stream )
+    {
+        os << "void chain" << index << "( std::ostream & os )\n{\n    os << ";
+    }
+    else
+    {
+        os << "auto chain" << index << "()\n{\n    return ";
+    }
+
+    for ( int k = 0; k < operands; ++k )
+    {
+        int const d = ( index * 7 + k * 3 + index / ndims ) % ndims;
+
+        os << ( k == 0 ? "" : k % 2 ? " * " : " / " ) << "q" << d << "( " << k + 1 << ".5 )";
+    }
+    os << ( stream ? " << '\\n';\n}\n\n" : ";\n}\n\n" );
+}
+
+int main( int argc, char * argv[] )
+{
+    std::string const mode = argc == 4 ? argv[3] : "";
+
+    if ( ( argc != 3 && argc != 4 ) ||
+         ( mode != "" && mode != "fwd" && mode != "include" && mode != "pch" && mode != "module" ) )
+    {
+        std::cerr << "Usage: gen-compile ndims nchains [fwd|include|pch|module]\n";
+        return EXIT_FAILURE;
+    }
+
+    int const ndims   = std::atoi( argv[1] );
+    int const nchains = std::atoi( argv[2] );
+    bool const stream = mode == "" || mode == "fwd";
+
+    if ( ndims < 1 || nchains < 0 )
+    {
+        std::cerr << "gen-compile: expecting ndims >= 1, nchains >= 0\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "// generated by gen-compile " << ndims << " " << nchains << ( mode.empty() ? "" : " " ) << mode << "\n\n";
+
+    if ( mode == "" || mode == "fwd" )
+    {
+        std::cout <<
+            "#include \"phys/units/" << ( mode == "fwd" ? "quantity_io_fwd.hpp" : "io.hpp" ) << "\"\n\n"
+            "#include <iostream>\n\n"
+            "using namespace phys::units;\n"
+            "using namespace phys::units::io;\n\n";
+    }
+    else if ( mode == "include" )
+    {
+        std::cout <<
+            "#include \"phys/units/quantity.hpp\"\n"
+            "#include \"phys/units/other_units.hpp\"\n"
+            "#include \"phys/units/physical_constants.hpp\"\n"
+            "#include \"phys/units/io.hpp\"\n\n"
+            "using namespace phys::units;\n\n";
+    }
+    else if ( mode == "pch" )
+    {
+        std::cout <<
+            "#include \"pch-units.hpp\"\n\n"
+            "using namespace phys::units;\n\n";
+    }
+    else
+    {
+        std::cout <<
+            "import phys.units;\n\n"
+            "using namespace phys::units;\n\n";
+    }
+
+    for ( int i = 0; i < ndims; ++i )
+    {
+        dimension( std::cout, i );
+    }
+
+    for ( int i = 0; i < nchains; ++i )
+    {
+        chain( std::cout, i, ndims, stream );
+    }
+
+    if ( stream )
+    {
+        std::cout << "int main()\n{\n";
+        for ( int i = 0; i < nchains; ++i )
+        {
+            std::cout << "    chain" << i << "( std::cout );\n";
+        }
+        std::cout << "}\n";
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,129 @@
+/*
+ * interval.cpp
+ *
+ * Power envelope p = i * i * r + v * v / r over arrays, for:
+ * - quantity< Dims >, no bounds,
+ * - quantity< Dims, interval<> >, round to nearest and widen outward,
+ * - lower and upper bounds on Rep, switching the rounding mode per bound.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_interval.hpp"
+
+#include <algorithm>
+#include <cfenv>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 100000;   // elements
+const int reps = 100;      // n * reps evaluations
+
+typedef interval<> iv;
+
+/**
+ * dissipated power of current i through r plus that of voltage v across r.
+ */
+template< typename T >
+quantity< power_d, T > envelope(
+    quantity< electric_current_d, T > const & i, quantity< electric_resistance_d, T > const & r,
+    quantity< electric_potential_d, T > const & v )
+{
+    return i * i * r + v * v / r;
+}
+
+void report( char const * const text, double const seconds, double const base )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * reps ) << " ns/evaluation, "
+              << seconds / base << " x scalar" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Power envelope, " << double( n ) * reps << " evaluations." << std::endl;
+
+    std::vector< quantity< electric_current_d > > i( n );
+    std::vector< quantity< electric_resistance_d > > r( n );
+    std::vector< quantity< electric_potential_d > > v( n );
+
+    std::vector< quantity< electric_current_d, iv > > ii( n );
+    std::vector< quantity< electric_resistance_d, iv > > ri( n );
+    std::vector< quantity< electric_potential_d, iv > > vi( n );
+
+    for ( int k = 0; k < n; ++k )
+    {
+        i[k] = ( 2.0 + 1e-5 * k ) * ampere();
+        r[k] = ( 5.0 + 1e-5 * k ) * ohm();
+        v[k] = ( 0.5 + 1e-6 * k ) * volt();
+
+        ii[k] = iv( 0.95, 1.05 ) * i[k];
+        ri[k] = iv( 0.95, 1.05 ) * r[k];
+        vi[k] = iv( 0.99, 1.01 ) * v[k];
+    }
+
+    std::vector< quantity< power_d > > p( n ), lo( n ), hi( n );
+    std::vector< quantity< power_d, iv > > pi( n );
+
+    stopwatch sw;
+    for ( int t = 0; t < reps; ++t )
+    {
+        for ( int k = 0; k < n; ++k )
+        {
+            p[k] = envelope( i[k], r[k], v[k] );
+        }
+        keep( p[n / 2] );
+    }
+    const double scalar = sw.elapsed();
+    report( "quantity< Dims >:                ", scalar, scalar );
+
+    sw.restart();
+    for ( int t = 0; t < reps; ++t )
+    {
+        for ( int k = 0; k < n; ++k )
+        {
+            pi[k] = envelope( ii[k], ri[k], vi[k] );
+        }
+        keep( pi[n / 2] );
+    }
+    report( "quantity< Dims, interval<> >:    ", sw.elapsed(), scalar );
+
+    // hand-written bounds for positive operands: the divisor takes the opposite bound
+
+    sw.restart();
+    for ( int t = 0; t < reps; ++t )
+    {
+        std::fesetround( FE_DOWNWARD );
+        for ( int k = 0; k < n; ++k )
+        {
+            lo[k] = lower( ii[k] ) * lower( ii[k] ) * lower( ri[k] ) + lower( vi[k] ) * lower( vi[k] ) / upper( ri[k] );
+        }
+        std::fesetround( FE_UPWARD );
+        for ( int k = 0; k < n; ++k )
+        {
+            hi[k] = upper( ii[k] ) * upper( ii[k] ) * upper( ri[k] ) + upper( vi[k] ) * upper( vi[k] ) / lower( ri[k] );
+        }
+        std::fesetround( FE_TONEAREST );
+        keep( lo[n / 2] );
+        keep( hi[n / 2] );
+    }
+    report( "rounding mode per bound, Rep:    ", sw.elapsed(), scalar );
+
+    double widest = 0;
+    for ( int k = 0; k < n; ++k )
+    {
+        widest = std::max( widest, ( upper( pi[k] ) - lower( pi[k] ) ) / p[k] );
+    }
+    std::cout << "widest relative envelope: " << widest << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
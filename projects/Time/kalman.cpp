@@ -0,0 +1,154 @@
+/*
+ * kalman.cpp
+ *
+ * Kalman filter covariance prediction, P' = F P F^T + Q, for 6 and 9 states,
+ * with quantity_matrix versus raw double[N][N].
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_matrix.hpp"
+
+#include <iostream>
+
+using namespace phys::units;
+
+const int iterations = 1000000;
+
+template< int N >
+struct raw
+{
+    double m[N][N];
+};
+
+template< int N >
+inline raw<N> multiply( raw<N> const & a, raw<N> const & b )
+{
+    raw<N> r;
+    for ( int i = 0; i < N; ++i )
+        for ( int j = 0; j < N; ++j )
+        {
+            double sum = 0;
+            for ( int k = 0; k < N; ++k )
+                sum += a.m[i][k] * b.m[k][j];
+            r.m[i][j] = sum;
+        }
+    return r;
+}
+
+template< int N >
+inline raw<N> transpose( raw<N> const & a )
+{
+    raw<N> r;
+    for ( int i = 0; i < N; ++i )
+        for ( int j = 0; j < N; ++j )
+            r.m[j][i] = a.m[i][j];
+    return r;
+}
+
+template< int N >
+inline raw<N> add( raw<N> const & a, raw<N> const & b )
+{
+    raw<N> r;
+    for ( int i = 0; i < N; ++i )
+        for ( int j = 0; j < N; ++j )
+            r.m[i][j] = a.m[i][j] + b.m[i][j];
+    return r;
+}
+
+/*
+ * constant-velocity (6 states) or constant-acceleration (9 states) transition,
+ * three axes, time step dt.
+ */
+template< typename Matrix, typename Setter >
+void init_transition( Matrix & F, int const n, Setter set )
+{
+    double const dt = 1e-3;
+
+    for ( int i = 0; i < n; ++i )
+        for ( int j = 0; j < n; ++j )
+        {
+            int const d = j / 3 - i / 3;
+            set( F, i, j, i % 3 != j % 3 || d < 0 ? 0.0 : d == 0 ? 1.0 : d == 1 ? dt : 0.5 * dt * dt );
+        }
+}
+
+/*
+ * diagonally dominant covariance P and process noise Q.
+ */
+template< typename Matrix, typename Setter >
+void init_covariance( Matrix & P, Matrix & Q, int const n, Setter set )
+{
+    for ( int i = 0; i < n; ++i )
+        for ( int j = 0; j < n; ++j )
+        {
+            set( P, i, j, i == j ? 1.0 : 0.01 );
+            set( Q, i, j, i == j ? 1e-6 : 0.0 );
+        }
+}
+
+template< int N >
+void time_raw()
+{
+    raw<N> F, P, Q;
+    init_transition( F, N, []( raw<N> & m, int i, int j, double v ) { m.m[i][j] = v; } );
+    init_covariance( P, Q, N, []( raw<N> & m, int i, int j, double v ) { m.m[i][j] = v; } );
+
+    stopwatch sw;
+    for ( int k = 0; k < iterations; ++k )
+    {
+        P = add( multiply( multiply( F, P ), transpose( F ) ), Q );
+        P.m[0][0] *= 0.5;   // keep the values bounded
+    }
+    std::cout << N << " states, raw double[N][N]: " << 1e9 * sw.elapsed() / iterations << " ns/predict" << std::endl;
+    keep( P.m[N-1][N-1] );
+}
+
+template< typename States >
+void time_quantity()
+{
+    typedef quantity_matrix< States, States > covariance;
+    typedef quantity_matrix< States, typename detail::list_reciprocal< States >::type > transition;
+
+    enum { N = States::size };
+
+    detail::permit<double> const p;
+
+    transition F; covariance P, Q;
+    init_transition( F, N, [&p]( transition & m, int i, int j, double v ) { m.value( i, j, p ) = v; } );
+    init_covariance( P, Q, N, [&p]( covariance & m, int i, int j, double v ) { m.value( i, j, p ) = v; } );
+
+    stopwatch sw;
+    for ( int k = 0; k < iterations; ++k )
+    {
+        P = F * P * transpose( F ) + Q;
+        P.value( 0, 0, p ) *= 0.5;
+    }
+    std::cout << N << " states, quantity_matrix:  " << 1e9 * sw.elapsed() / iterations << " ns/predict" << std::endl;
+    keep( P.value( N-1, N-1, p ) );
+}
+
+typedef dimension_list< length_d, length_d, length_d, speed_d, speed_d, speed_d > pv_d;
+
+typedef dimension_list< length_d, length_d, length_d, speed_d, speed_d, speed_d,
+    acceleration_d, acceleration_d, acceleration_d > pva_d;
+
+int main()
+{
+    std::cout << "Kalman covariance prediction, " << iterations << " iterations." << std::endl;
+
+    time_raw<6>();
+    time_quantity<pv_d>();
+    time_raw<9>();
+    time_quantity<pva_d>();
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,115 @@
+/*
+ * logger.cpp
+ *
+ * Latency of logging a quantity from a time-critical loop, for:
+ * - io::operator<< to a file stream, one line per quantity,
+ * - quantity_logger::log(), drained to a file by its background thread.
+ *
+ * Each call is timed on its own; the table shows percentiles of the
+ * latency, including the cost of a clock read.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+using namespace phys::units::io;
+
+const int n = 200000;   // calls
+
+char const * const path = "logger.log";
+
+typedef std::chrono::steady_clock clock_type;
+
+void report( char const * const text, std::vector< double > ns )
+{
+    std::sort( ns.begin(), ns.end() );
+
+    double const p[] = { 0.5, 0.9, 0.99, 0.999 };
+
+    std::cout << text << std::fixed << std::setprecision( 0 );
+    for ( int i = 0; i < 4; ++i )
+    {
+        std::cout << std::setw( 10 ) << ns[ std::size_t( p[i] * ( ns.size() - 1 ) ) ];
+    }
+    std::cout << std::setw( 10 ) << ns.back() << std::endl;
+}
+
+template< typename F >
+std::vector< double > measure( F f )
+{
+    std::vector< double > ns( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        quantity< electric_potential_d > const u = ( 230 + 1e-3 * i ) * volt();
+
+        clock_type::time_point const t0 = clock_type::now();
+        f( u );
+        clock_type::time_point const t1 = clock_type::now();
+
+        ns[i] = double( std::chrono::duration_cast< std::chrono::nanoseconds >( t1 - t0 ).count() );
+    }
+    return ns;
+}
+
+int main()
+{
+    std::cout << "Logging a voltage, " << n << " calls, latency in ns." << std::endl;
+    std::cout << "                     p50       p90       p99     p99.9       max" << std::endl;
+
+    {
+        std::ofstream os( path );
+
+        report( "operator<<:    ", measure( [&os]( quantity< electric_potential_d > const & u )
+        {
+            os << u << '\n';
+        } ) );
+    }
+
+    {
+        std::ofstream os( path );
+        quantity_logger log( 1 << 18 );
+
+        log.start( os, std::chrono::milliseconds( 10 ) );
+
+        report( "quantity_logger:", measure( [&log]( quantity< electric_potential_d > const & u )
+        {
+            log.log( "supply", u );
+        } ) );
+
+        log.stop();
+
+        if ( log.dropped() )
+        {
+            std::cout << "dropped: " << log.dropped() << std::endl;
+        }
+    }
+
+    report( "clock only:    ", measure( []( quantity< electric_potential_d > const & u )
+    {
+        keep( u );
+    } ) );
+
+    std::remove( path );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
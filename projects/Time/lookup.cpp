@@ -0,0 +1,137 @@
+/*
+ * lookup.cpp
+ *
+ * Interpolated lookups of resistance versus temperature, for:
+ * - std::upper_bound and a linear interpolation on plain doubles,
+ * - lookup_table with non-uniform keys (branchless search),
+ * - lookup_table with uniform keys (direct indexing),
+ * - lookup_table batch evaluation.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_lookup.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int entries = 1024;
+const int n       = 1000000;   // lookups
+const int reps    = 20;
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * reps ) << " ns/lookup" << std::endl;
+}
+
+double naive( std::vector<double> const & x, std::vector<double> const & y, double const v )
+{
+    std::size_t i = std::upper_bound( x.begin(), x.end(), v ) - x.begin();
+    i = i < 1 ? 1 : i > x.size() - 1 ? x.size() - 1 : i;
+
+    return y[i - 1] + ( y[i] - y[i - 1] ) / ( x[i] - x[i - 1] ) * ( v - x[i - 1] );
+}
+
+int main()
+{
+    std::cout << "Table lookup, " << entries << " entries, " << n << " lookups x " << reps << " repetitions." << std::endl;
+
+    std::vector<double> dx( entries ), dy( entries ), dq( n );
+
+    for ( int i = 0; i < entries; ++i )
+    {
+        dx[i] = 200.0 + 0.5 * i;
+        dy[i] = 1.0 + 0.004 * i + 1e-6 * i * i;
+    }
+
+    std::srand( 42 );
+    for ( int i = 0; i < n; ++i )
+    {
+        dq[i] = 200.0 + 511.5 * std::rand() / RAND_MAX;
+    }
+
+    std::vector< quantity<thermodynamic_temperature_d> > qx( entries ), qq( n );
+    std::vector< quantity<electric_resistance_d> > qy( entries ), qout( n );
+
+    for ( int i = 0; i < entries; ++i )
+    {
+        qx[i] = dx[i] * kelvin();
+        qy[i] = dy[i] * ohm();
+    }
+
+    for ( int i = 0; i < n; ++i )
+    {
+        qq[i] = dq[i] * kelvin();
+    }
+
+    typedef lookup_table< thermodynamic_temperature_d, electric_resistance_d > table_type;
+
+    const table_type searched( &qx[0], &qy[0], entries );
+    const table_type indexed( qx[0], qx[1] - qx[0], &qy[0], entries );
+
+    stopwatch sw;
+    for ( int k = 0; k < reps; ++k )
+    {
+        double sum = 0;
+        for ( int i = 0; i < n; ++i )
+        {
+            sum += naive( dx, dy, dq[i] );
+        }
+        keep( sum );
+    }
+    report( "double   upper_bound:    ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        quantity<electric_resistance_d> sum = 0 * ohm();
+        for ( int i = 0; i < n; ++i )
+        {
+            sum += searched( qq[i] );
+        }
+        keep( sum );
+    }
+    report( "quantity search:        ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        quantity<electric_resistance_d> sum = 0 * ohm();
+        for ( int i = 0; i < n; ++i )
+        {
+            sum += indexed( qq[i] );
+        }
+        keep( sum );
+    }
+    report( "quantity uniform:       ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        searched( &qq[0], n, &qout[0] );
+        keep( qout[n / 2] );
+    }
+    report( "quantity search batch:  ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        indexed( &qq[0], n, &qout[0] );
+        keep( qout[n / 2] );
+    }
+    report( "quantity uniform batch: ", sw.elapsed() );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,102 @@
+/*
+ * measurement.cpp
+ *
+ * Power P = V * I with first-order uncertainty for 10^6 readings, for:
+ * - a hand-written pass over separate value and uncertainty arrays of doubles,
+ * - propagate_product() over separate arrays of quantities,
+ * - quantity< Dims, measurement<> > arrays, one product at a time.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_measurement.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 1000000;   // readings
+const int reps = 50;        // n * reps products
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * reps ) << " ns/product" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Uncertainty propagation, P = V * I, " << double( n ) * reps << " products." << std::endl;
+
+    std::vector<double> dv( n ), duv( n ), di( n ), dui( n ), dp( n ), dup( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        dv[i]  = 12.0 + 1e-6 * i;
+        duv[i] = 0.1;
+        di[i]  = 2.0 - 1e-7 * i;
+        dui[i] = 0.05;
+    }
+
+    std::vector< quantity<electric_potential_d> > qv( n ), quv( n );
+    std::vector< quantity<electric_current_d> > qi( n ), qui( n );
+    std::vector< quantity<power_d> > qp( n ), qup( n );
+
+    std::vector< quantity<electric_potential_d, measurement<> > > mv( n );
+    std::vector< quantity<electric_current_d, measurement<> > > mi( n );
+    std::vector< quantity<power_d, measurement<> > > mp( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        qv[i] = dv[i] * volt();  quv[i] = duv[i] * volt();
+        qi[i] = di[i] * ampere(); qui[i] = dui[i] * ampere();
+
+        mv[i] = measurement<>( dv[i], duv[i] ) * volt();
+        mi[i] = measurement<>( di[i], dui[i] ) * ampere();
+    }
+
+    stopwatch sw;
+    for ( int k = 0; k < reps; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            const double a = di[i] * duv[i];
+            const double b = dv[i] * dui[i];
+
+            dp[i]  = dv[i] * di[i];
+            dup[i] = std::sqrt( a * a + b * b );
+        }
+        keep( dup[n / 2] );
+    }
+    report( "double   arrays:            ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        propagate_product( &qv[0], &quv[0], &qi[0], &qui[0], n, &qp[0], &qup[0] );
+        keep( qup[n / 2] );
+    }
+    report( "quantity propagate_product: ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            mp[i] = mv[i] * mi[i];
+        }
+        keep( mp[n / 2] );
+    }
+    report( "quantity<measurement>:      ", sw.elapsed() );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,133 @@
+/*
+ * packed-array.cpp
+ *
+ * Scans and aggregates over sampled voltage and current, for:
+ * - quantity< ..., double > arrays,
+ * - packed_quantity_array with int16 codes fitted per block.
+ *
+ * The arrays are larger than the caches, so the packed arrays move a
+ * quarter of the bytes from memory. Rates are in samples per nanosecond.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_packed.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 16 * 1024 * 1024;   // samples
+const int reps = 10;
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << double( n ) * reps / seconds / 1e9 << " samples/ns" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Voltage and current, " << n << " samples, " << reps << " repetitions." << std::endl;
+
+    std::vector< quantity< electric_potential_d > > u( n );
+    std::vector< quantity< electric_current_d > > i( n );
+
+    std::srand( 42 );
+    for ( int k = 0; k < n; ++k )
+    {
+        u[k] = ( 325 * std::sin( 2 * 3.14159265358979 * 50 * k / 10000.0 ) + 0.1 * std::rand() / RAND_MAX ) * volt();
+        i[k] = ( 16 * std::sin( 2 * 3.14159265358979 * 50 * k / 10000.0 - 0.3 ) ) * ampere();
+    }
+
+    packed_quantity_array< electric_potential_d > pu( &u[0], n );
+    packed_quantity_array< electric_current_d > pi( &i[0], n );
+
+    std::cout << "memory: double " << 2.0 * n * sizeof( Rep ) / 1e6 << " MB, packed "
+              << ( pu.bytes() + pi.bytes() ) / 1e6 << " MB" << std::endl;
+
+    std::vector< quantity< electric_potential_d > > buffer( n );
+
+    stopwatch sw;
+    for ( int r = 0; r < reps; ++r )
+    {
+        std::memcpy( &buffer[0], &u[0], n * sizeof( Rep ) );
+        keep( buffer[r] );
+    }
+    report( "scan, copy doubles:           ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        pu.decode( 0, n, &buffer[0] );
+        keep( buffer[r] );
+    }
+    report( "scan, decode packed:          ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        quantity< electric_potential_d > s = 0 * volt();
+        for ( int k = 0; k < n; ++k )
+        {
+            s += u[k];
+        }
+        keep( s );
+    }
+    report( "sum, doubles:                 ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        keep( sum( pu ) );
+    }
+    report( "sum, packed codes:            ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        quantity< power_d > p = 0 * watt();
+        for ( int k = 0; k < n; ++k )
+        {
+            p += u[k] * i[k];
+        }
+        keep( p / n );
+    }
+    report( "mean power, doubles:          ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        keep( mean( pu * pi ) );
+    }
+    report( "mean power, packed fused:     ", sw.elapsed() );
+
+    sw.restart();
+    for ( int r = 0; r < reps; ++r )
+    {
+        pu.decode( 0, n, &buffer[0] );
+        std::vector< quantity< electric_current_d > > current( n );
+        pi.decode( 0, n, &current[0] );
+
+        quantity< power_d > p = 0 * watt();
+        for ( int k = 0; k < n; ++k )
+        {
+            p += buffer[k] * current[k];
+        }
+        keep( p / n );
+    }
+    report( "mean power, decode then sum:  ", sw.elapsed() );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,117 @@
+/*
+ * particle-update.cpp
+ *
+ * Explicit Euler particle update, x += v * dt, v += a * dt, for:
+ * - structs of three plain doubles (array of structures),
+ * - quantity_vector< length_d > etc. (array of structures),
+ * - quantity_vector_array< length_d > etc. (structure of arrays).
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_vector.hpp"
+
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n     = 10000;   // particles
+const int steps = 2000;
+
+struct vec3 { double x, y, z; };
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * steps ) << " ns/particle-step" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Particle update, " << n << " particles x " << steps << " steps." << std::endl;
+
+    const double dt = 1e-3;
+
+    // plain doubles, array of structures
+
+    std::vector<vec3> dx( n ), dv( n ), da( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        vec3 const x = { 0.0, 0.0, 0.0 }, v = { 1.0, 0.5 * i / n, 0.0 }, a = { 0.0, 0.0, -9.81 };
+        dx[i] = x; dv[i] = v; da[i] = a;
+    }
+
+    stopwatch sw;
+
+    for ( int k = 0; k < steps; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            dx[i].x += dv[i].x * dt; dx[i].y += dv[i].y * dt; dx[i].z += dv[i].z * dt;
+            dv[i].x += da[i].x * dt; dv[i].y += da[i].y * dt; dv[i].z += da[i].z * dt;
+        }
+    }
+    report( "double   AoS: ", sw.elapsed() );
+    keep( dx[n/2].z );
+
+    // quantity_vector, array of structures
+
+    typedef quantity_vector< length_d > position;
+    typedef quantity_vector< speed_d > velocity;
+    typedef quantity_vector< acceleration_d > acceleration;
+
+    std::vector<position> qx( n, position::zero() );
+    std::vector<velocity> qv( n );
+    std::vector<acceleration> qa( n, acceleration( 0 * meter() / square( second() ), 0 * meter() / square( second() ), -9.81 * meter() / square( second() ) ) );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        qv[i] = velocity( 1.0 * meter() / second(), 0.5 * i / n * meter() / second(), 0 * meter() / second() );
+    }
+
+    const quantity<time_interval_d> qdt = dt * second();
+
+    sw.restart();
+    for ( int k = 0; k < steps; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            qx[i] += qv[i] * qdt;
+            qv[i] += qa[i] * qdt;
+        }
+    }
+    report( "quantity AoS: ", sw.elapsed() );
+    keep( qx[n/2] );
+
+    // quantity_vector_array, structure of arrays
+
+    quantity_vector_array< length_d > sx( n );
+    quantity_vector_array< speed_d > sv( n );
+    quantity_vector_array< acceleration_d > sa( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        sv.set( i, qv[i] );
+        sa.set( i, qa[i] );
+    }
+
+    sw.restart();
+    for ( int k = 0; k < steps; ++k )
+    {
+        sx.add_scaled( sv, qdt );
+        sv.add_scaled( sa, qdt );
+    }
+    report( "quantity SoA: ", sw.elapsed() );
+    keep( sx[n/2] );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,23 @@
+/*
+ * pch-units.hpp
+ *
+ * Headers of the phys.units module, to precompile for compilers without
+ * module support; see target build-time in Makefile.win32.gcc.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef PCH_UNITS_HPP_INCLUDED
+#define PCH_UNITS_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/other_units.hpp"
+#include "phys/units/physical_constants.hpp"
+#include "phys/units/io.hpp"
+
+#endif // PCH_UNITS_HPP_INCLUDED
+
+/*
+ * end of file
+ */
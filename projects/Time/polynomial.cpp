@@ -0,0 +1,110 @@
+/*
+ * polynomial.cpp
+ *
+ * 10^8 evaluations of a degree-four heat capacity polynomial versus
+ * temperature, for:
+ * - Horner's scheme on plain doubles,
+ * - polynomial, Horner's scheme, one at a time and batched,
+ * - polynomial, Estrin's scheme, batched.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_polynomial.hpp"
+
+#include <iostream>
+#include <vector>
+
+using namespace phys::units;
+
+const int n    = 1000000;   // temperatures
+const int reps = 100;       // n * reps evaluations
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * reps ) << " ns/evaluation" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Polynomial evaluation, degree 4, " << double( n ) * reps << " evaluations." << std::endl;
+
+    // heat capacity of N2 divided by R, 300-1000 K, NASA 7-coefficient form
+
+    const double c[5] = { 3.53100528, -1.23660988e-4, -5.02999433e-7, 2.43530612e-9, -1.40881235e-12 };
+
+    std::vector<double> dt( n ), dout( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        dt[i] = 300.0 + 700.0 * i / n;
+    }
+
+    const quantity<heat_capacity_d> R = 8.314462618 * joule() / kelvin();
+    const quantity<thermodynamic_temperature_d> K = kelvin();
+
+    typedef polynomial< thermodynamic_temperature_d, heat_capacity_d, 4 > heat_capacity_polynomial;
+
+    const heat_capacity_polynomial cp(
+        c[0] * R, c[1] * R / K, c[2] * R / K / K, c[3] * R / K / K / K, c[4] * R / K / K / K / K );
+
+    std::vector< quantity<thermodynamic_temperature_d> > qt( n );
+    std::vector< quantity<heat_capacity_d> > qout( n );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        qt[i] = dt[i] * kelvin();
+    }
+
+    const double r = 8.314462618;
+    const double dc[5] = { c[0] * r, c[1] * r, c[2] * r, c[3] * r, c[4] * r };
+
+    stopwatch sw;
+    for ( int k = 0; k < reps; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            const double t = dt[i];
+            dout[i] = dc[0] + t * ( dc[1] + t * ( dc[2] + t * ( dc[3] + t * dc[4] ) ) );
+        }
+        keep( dout[n / 2] );
+    }
+    report( "double   Horner:        ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            qout[i] = cp( qt[i] );
+        }
+        keep( qout[n / 2] );
+    }
+    report( "quantity Horner:        ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        cp( &qt[0], n, &qout[0] );
+        keep( qout[n / 2] );
+    }
+    report( "quantity Horner, batch: ", sw.elapsed() );
+
+    sw.restart();
+    for ( int k = 0; k < reps; ++k )
+    {
+        cp.estrin( &qt[0], n, &qout[0] );
+        keep( qout[n / 2] );
+    }
+    report( "quantity Estrin, batch: ", sw.elapsed() );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,219 @@
+/*
+ * ring.cpp
+ *
+ * Passing batches of voltages from producer processes to a consumer
+ * process on the same host, for:
+ * - text over a pipe: io::to_string() per value, parsed with strtod(),
+ * - quantity_ring with one producer,
+ * - quantity_ring with two producers,
+ * and the one-way latency of a one-value batch, from the round trip
+ * through a request ring and a reply ring.
+ *
+ * Waiting sides yield the processor, so that the programme also runs on
+ * machines with fewer processors than processes.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_ring.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace phys::units;
+
+const int batch   = 256;     // values per batch
+const int batches = 20000;
+const int trips   = 20000;
+
+char const * const request_name = "/ring-request";
+char const * const reply_name   = "/ring-reply";
+
+std::vector< quantity< electric_potential_d > > make_batch( int const b )
+{
+    std::vector< quantity< electric_potential_d > > u( batch );
+    for ( int k = 0; k < batch; ++k )
+    {
+        u[k] = ( 230 + 0.001 * ( b + k ) ) * volt();
+    }
+    return u;
+}
+
+void report( char const * const text, double const seconds )
+{
+    double const values = double( batch ) * batches;
+
+    std::cout << text << values / seconds / 1e6 << " M values/s, "
+              << values * sizeof( Rep ) / seconds / 1e9 << " GB/s" << std::endl;
+}
+
+void text_pipe()
+{
+    int fd[2];
+    if ( ::pipe( fd ) != 0 )
+    {
+        return;
+    }
+
+    stopwatch sw;
+
+    if ( ::fork() == 0 )
+    {
+        ::close( fd[0] );
+        FILE * const out = ::fdopen( fd[1], "w" );
+
+        for ( int b = 0; b < batches; ++b )
+        {
+            std::vector< quantity< electric_potential_d > > const u = make_batch( b );
+            for ( int k = 0; k < batch; ++k )
+            {
+                std::fputs( io::to_string( u[k] ).c_str(), out );
+                std::fputc( '\n', out );
+            }
+        }
+        std::fclose( out );
+        ::_exit( 0 );
+    }
+
+    ::close( fd[1] );
+    FILE * const in = ::fdopen( fd[0], "r" );
+
+    char line[64];
+    Rep sum = 0;
+    while ( std::fgets( line, sizeof line, in ) )
+    {
+        sum += std::strtod( line, 0 );
+    }
+    std::fclose( in );
+    ::wait( 0 );
+
+    keep( sum );
+    report( "text over a pipe:  ", sw.elapsed() );
+}
+
+void ring_throughput( int const producers )
+{
+    quantity_ring ring( request_name, 256, batch * sizeof( Rep ),
+        producers > 1 ? quantity_ring::multi_producer : quantity_ring::single_producer );
+
+    stopwatch sw;
+
+    for ( int p = 0; p < producers; ++p )
+    {
+        if ( ::fork() == 0 )
+        {
+            quantity_ring child( request_name );
+
+            for ( int b = p; b < batches; b += producers )
+            {
+                std::vector< quantity< electric_potential_d > > const u = make_batch( b );
+                while ( ! child.try_push( &u[0], batch ) )
+                {
+                    ::sched_yield();
+                }
+            }
+            ::_exit( 0 );
+        }
+    }
+
+    quantity< electric_potential_d > sum = 0 * volt();
+    for ( int b = 0; b < batches; )
+    {
+        if ( ring.empty() )
+        {
+            ::sched_yield();
+            continue;
+        }
+        column_view< electric_potential_d > const u = ring.front< electric_potential_d >();
+        for ( std::size_t k = 0; k < u.size(); ++k )
+        {
+            sum += u[k];
+        }
+        ring.pop();
+        ++b;
+    }
+    for ( int p = 0; p < producers; ++p )
+    {
+        ::wait( 0 );
+    }
+
+    keep( sum );
+    report( producers > 1 ? "ring, 2 producers: " : "ring, 1 producer:  ", sw.elapsed() );
+}
+
+void ring_latency()
+{
+    quantity_ring request( request_name, 16, sizeof( Rep ) );
+    quantity_ring reply( reply_name, 16, sizeof( Rep ) );
+
+    if ( ::fork() == 0 )
+    {
+        quantity_ring in( request_name );
+        quantity_ring out( reply_name );
+
+        for ( int t = 0; t < trips; ++t )
+        {
+            while ( in.empty() )
+            {
+                ::sched_yield();
+            }
+            quantity< electric_potential_d > const u = in.front< electric_potential_d >()[0];
+            in.pop();
+
+            while ( ! out.try_push( &u, 1 ) )
+            {
+                ::sched_yield();
+            }
+        }
+        ::_exit( 0 );
+    }
+
+    stopwatch sw;
+    for ( int t = 0; t < trips; ++t )
+    {
+        quantity< electric_potential_d > const u = t * volt();
+        while ( ! request.try_push( &u, 1 ) )
+        {
+            ::sched_yield();
+        }
+        while ( reply.empty() )
+        {
+            ::sched_yield();
+        }
+        keep( reply.front< electric_potential_d >()[0] );
+        reply.pop();
+    }
+    double const elapsed = sw.elapsed();
+    ::wait( 0 );
+
+    std::cout << "ring latency:      " << 1e6 * elapsed / trips / 2 << " us one way" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Voltage batches between processes, " << batches << " batches of "
+              << batch << " values, " << ::sysconf( _SC_NPROCESSORS_ONLN ) << " processors." << std::endl;
+
+    text_pipe();
+    ring_throughput( 1 );
+    ring_throughput( 2 );
+    ring_latency();
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,139 @@
+/*
+ * sharded.cpp
+ *
+ * Accumulation of one energy total from 1 to 64 threads, for:
+ * - quantity< energy_d > protected by a std::mutex,
+ * - atomic_quantity< energy_d >::fetch_add(),
+ * - sharded_accumulator< energy_d >, one shard per thread,
+ * - sharded_accumulator< energy_d, Rep, true >, with Kahan compensation,
+ * - sharded_accumulator< energy_d >::add( q ), shards claimed per thread,
+ * - the same with half as many shards as threads, the rest sharing one.
+ *
+ * Requires C++11; link with -pthread.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_atomic.hpp"
+#include "phys/units/quantity_sharded.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace phys::units;
+
+const int n = 1 << 22;   // additions per run, divided over the threads
+
+template< typename Work >
+double run( int const threads, Work work )
+{
+    std::vector< std::thread > pool;
+    stopwatch sw;
+
+    for ( int t = 0; t < threads; ++t )
+    {
+        pool.push_back( std::thread( work, t, n / threads ) );
+    }
+    for ( int t = 0; t < threads; ++t )
+    {
+        pool[t].join();
+    }
+    return sw.elapsed();
+}
+
+void check( double const total, char const * const text )
+{
+    if ( total != n * 0.5 )
+    {
+        std::cerr << text << ": lost updates, total " << total << ", expected " << n * 0.5 << std::endl;
+        std::exit( EXIT_FAILURE );
+    }
+}
+
+template< bool Compensated >
+double sharded( int const threads )
+{
+    sharded_accumulator< energy_d, Rep, Compensated > acc( threads );
+
+    double const t = run( threads, [&acc]( int const self, int const count )
+    {
+        for ( int i = 0; i < count; ++i )
+        {
+            acc.add( 0.5 * joule(), self );
+        }
+    } );
+    check( acc.total() / joule(), "sharded_accumulator" );
+
+    return t;
+}
+
+double claimed( int const threads, int const shards )
+{
+    sharded_accumulator< energy_d > acc( shards );
+
+    double const t = run( threads, [&acc]( int, int const count )
+    {
+        for ( int i = 0; i < count; ++i )
+        {
+            acc.add( 0.5 * joule() );
+        }
+    } );
+    check( acc.total() / joule(), "sharded_accumulator::add( q )" );
+
+    return t;
+}
+
+int main()
+{
+    std::cout << "Shared accumulation, " << n << " additions, ns/addition (total of all threads)." << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "mutex" << std::setw(12) << "fetch_add" <<
+        std::setw(12) << "sharded" << std::setw(12) << "kahan" << std::setw(12) << "add(q)" << std::setw(12) << "half" << std::endl;
+
+    for ( int threads = 1; threads <= 64; threads *= 2 )
+    {
+        quantity< energy_d > mq( 0 * joule() );
+        std::mutex mutex;
+
+        double const t1 = run( threads, [&mq, &mutex]( int, int const count )
+        {
+            for ( int i = 0; i < count; ++i )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                mq += 0.5 * joule();
+            }
+        } );
+        check( mq / joule(), "mutex" );
+
+        atomic_quantity< energy_d > aq;
+
+        double const t2 = run( threads, [&aq]( int, int const count )
+        {
+            for ( int i = 0; i < count; ++i )
+            {
+                aq.fetch_add( 0.5 * joule(), std::memory_order_relaxed );
+            }
+        } );
+        check( aq.load() / joule(), "atomic_quantity" );
+
+        double const t3 = sharded< false >( threads );
+        double const t4 = sharded< true  >( threads );
+        double const t5 = claimed( threads, threads );
+        double const t6 = claimed( threads, threads > 1 ? threads / 2 : 1 );
+
+        std::cout << std::setw(8) << threads << std::setw(12) << 1e9 * t1 / n << std::setw(12) << 1e9 * t2 / n <<
+            std::setw(12) << 1e9 * t3 / n << std::setw(12) << 1e9 * t4 / n <<
+            std::setw(12) << 1e9 * t5 / n << std::setw(12) << 1e9 * t6 / n << std::endl;
+    }
+}
+
+/*
+ * end of file
+ */
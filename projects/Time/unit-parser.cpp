@@ -0,0 +1,177 @@
+/*
+ * unit-parser.cpp
+ *
+ * Resolution of the unit strings of incoming records, for:
+ * - parse_unit_expression() on every record,
+ * - std::unordered_map behind a std::mutex,
+ * - unit_expression_cache, one thread,
+ * - unit_expression_cache shared by several threads.
+ *
+ * The records draw their unit from a table of unit strings as they appear
+ * in telemetry and metering data, with Zipf-distributed frequencies: a few
+ * strings make up most records, and the tail is long.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "TimeUtil.hpp"
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_unit_parser.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace phys::units;
+
+const int n       = 1000000;   // records
+const int reps    = 10;
+const int threads = 4;
+
+char const * const unit_strings[] =
+{
+    "kW.h", "V", "A", "kW", "degC", "Pa", "m3/s", "Hz", "kPa", "m/s",
+    "W", "N m", "mA", "bar", "L/min", "K", "kV", "rpm", "m3", "kg/m3",
+    "W/m2", "MW.h", "mm", "s", "kvar", "km/h", "m/s2", "J/kg/K", "uS/cm", "mg/L",
+    "MPa", "N", "kN", "ms", "mbar", "kWh", "GJ", "m3/h", "t/h", "kg/s",
+    "W/m/K", "mol/L", "lx", "dB", "uT", "mV", "Ohm", "kOhm", "nF", "ppm",
+};
+
+const int unit_count = sizeof unit_strings / sizeof unit_strings[0];
+
+void report( char const * const text, double const seconds )
+{
+    std::cout << text << 1e9 * seconds / ( double( n ) * reps ) << " ns/record" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Unit string resolution, " << unit_count << " distinct strings, Zipf s = 1.1, "
+              << n << " records x " << reps << " repetitions." << std::endl;
+
+    // strings the parser does not know (degC, rpm, kvar, dB, ppm) are replaced by V
+
+    std::vector< bool > known( unit_count );
+    std::vector< double > cdf( unit_count );
+
+    double total = 0;
+    for ( int i = 0; i < unit_count; ++i )
+    {
+        try
+        {
+            parse_unit_expression( unit_strings[i] );
+            known[i] = true;
+        }
+        catch ( quantity_error const & )
+        {
+            known[i] = false;
+        }
+        total += 1 / std::pow( i + 1.0, 1.1 );
+        cdf[i] = total;
+    }
+
+    std::srand( 42 );
+    std::vector< std::string > records;
+    records.reserve( n );
+    for ( int i = 0; i < n; ++i )
+    {
+        double const u = total * std::rand() / RAND_MAX;
+        int k = 0;
+        while ( k < unit_count - 1 && cdf[k] < u )
+        {
+            ++k;
+        }
+        records.push_back( known[k] ? unit_strings[k] : "V" );
+    }
+
+    stopwatch sw;
+    for ( int r = 0; r < reps; ++r )
+    {
+        Rep sum = 0;
+        for ( int i = 0; i < n; ++i )
+        {
+            sum += parse_unit_expression( records[i] ).factor;
+        }
+        keep( sum );
+    }
+    report( "parse every record:       ", sw.elapsed() );
+
+    {
+        std::unordered_map< std::string, unit_expression > map;
+        std::mutex mutex;
+
+        sw.restart();
+        for ( int r = 0; r < reps; ++r )
+        {
+            Rep sum = 0;
+            for ( int i = 0; i < n; ++i )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                std::unordered_map< std::string, unit_expression >::iterator pos = map.find( records[i] );
+                if ( pos == map.end() )
+                {
+                    pos = map.insert( std::make_pair( records[i], parse_unit_expression( records[i] ) ) ).first;
+                }
+                sum += pos->second.factor;
+            }
+            keep( sum );
+        }
+        report( "unordered_map and mutex:  ", sw.elapsed() );
+    }
+
+    {
+        unit_expression_cache cache;
+
+        sw.restart();
+        for ( int r = 0; r < reps; ++r )
+        {
+            Rep sum = 0;
+            for ( int i = 0; i < n; ++i )
+            {
+                sum += cache.lookup( records[i] ).factor;
+            }
+            keep( sum );
+        }
+        report( "unit_expression_cache:    ", sw.elapsed() );
+    }
+
+    {
+        unit_expression_cache cache;
+        std::vector< std::thread > workers;
+
+        sw.restart();
+        for ( int t = 0; t < threads; ++t )
+        {
+            workers.push_back( std::thread( [&cache, &records, t]
+            {
+                for ( int r = t; r < reps; r += threads )
+                {
+                    Rep sum = 0;
+                    for ( int i = 0; i < n; ++i )
+                    {
+                        sum += cache.lookup( records[i] ).factor;
+                    }
+                    keep( sum );
+                }
+            } ) );
+        }
+        for ( std::size_t t = 0; t < workers.size(); ++t )
+        {
+            workers[t].join();
+        }
+        report( "unit_expression_cache x4: ", sw.elapsed() );
+    }
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
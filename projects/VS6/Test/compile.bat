@@ -41,7 +41,7 @@ goto :EOF
 setlocal
 set OPT=%*
 :: ../../Test/TestInput.cpp
-cl -nologo -W3 -EHsc -GR %G_OPT% %OPT% -D_CRT_SECURE_NO_WARNINGS -I../../../ -I%CATCH_INCLUDE% -FeTest.exe ../../Test/Test.cpp ../../Test/TestArithmetic.cpp ../../Test/TestComparison.cpp ../../Test/TestCompile.cpp ../../Test/TestFunction.cpp ../../Test/TestOutput.cpp ../../Test/TestPrefix.cpp ../../Test/TestUnit.cpp && Test
+cl -nologo -W3 -EHsc -GR %G_OPT% %OPT% -D_CRT_SECURE_NO_WARNINGS -I../../../ -I%CATCH_INCLUDE% -FeTest.exe ../../Test/Test.cpp ../../Test/TestArithmetic.cpp ../../Test/TestAtomic.cpp ../../Test/TestCalculus.cpp ../../Test/TestChrono.cpp ../../Test/TestColumnFile.cpp ../../Test/TestComparison.cpp ../../Test/TestCompile.cpp ../../Test/TestCompressed.cpp ../../Test/TestCsv.cpp ../../Test/TestDimensions.cpp ../../Test/TestDual.cpp ../../Test/TestFunction.cpp ../../Test/TestInterval.cpp ../../Test/TestIoFwd.cpp ../../Test/TestLiterals.cpp ../../Test/TestLogger.cpp ../../Test/TestLookup.cpp ../../Test/TestMatrix.cpp ../../Test/TestMeasurement.cpp ../../Test/TestOutput.cpp ../../Test/TestPacked.cpp ../../Test/TestPolynomial.cpp ../../Test/TestPrefix.cpp ../../Test/TestRing.cpp ../../Test/TestSharded.cpp ../../Test/TestUnit.cpp ../../Test/TestUnitLiteral.cpp ../../Test/TestUnitParser.cpp ../../Test/TestVector.cpp && Test
 endlocal & goto :EOF
 
 :CATCH_ERROR
@@ -41,8 +41,8 @@ goto :EOF
 setlocal
 set OPT=%*
 :: ../../Test/TestInput.cpp
-g++ -Wall %G_OPT% %OPT% -I../../../ -I%CATCH_INCLUDE% -o Test.exe ../../Test/Test.cpp ../../Test/TestArithmetic.cpp ../../Test/TestComparison.cpp ../../Test/TestCompile.cpp ../../Test/TestFunction.cpp ../../Test/TestOutput.cpp ../../Test/TestPrefix.cpp ../../Test/TestUnit.cpp && Test
-::clang++ -Wall %G_OPT% %OPT% -I../../../ -I%CATCH_INCLUDE% -o Test.exe ../../Test/Test.cpp ../../Test/TestArithmetic.cpp ../../Test/TestComparison.cpp ../../Test/TestCompile.cpp ../../Test/TestFunction.cpp ../../Test/TestOutput.cpp ../../Test/TestPrefix.cpp ../../Test/TestUnit.cpp && Test
+g++ -Wall %G_OPT% %OPT% -I../../../ -I%CATCH_INCLUDE% -o Test.exe ../../Test/Test.cpp ../../Test/TestArithmetic.cpp ../../Test/TestAtomic.cpp ../../Test/TestCalculus.cpp ../../Test/TestChrono.cpp ../../Test/TestColumnFile.cpp ../../Test/TestComparison.cpp ../../Test/TestCompile.cpp ../../Test/TestCompressed.cpp ../../Test/TestCsv.cpp ../../Test/TestDimensions.cpp ../../Test/TestDual.cpp ../../Test/TestFunction.cpp ../../Test/TestInterval.cpp ../../Test/TestIoFwd.cpp ../../Test/TestLiterals.cpp ../../Test/TestLogger.cpp ../../Test/TestLookup.cpp ../../Test/TestMatrix.cpp ../../Test/TestMeasurement.cpp ../../Test/TestOutput.cpp ../../Test/TestPacked.cpp ../../Test/TestPolynomial.cpp ../../Test/TestPrefix.cpp ../../Test/TestRing.cpp ../../Test/TestSharded.cpp ../../Test/TestUnit.cpp ../../Test/TestUnitLiteral.cpp ../../Test/TestUnitParser.cpp ../../Test/TestVector.cpp && Test
+::clang++ -Wall %G_OPT% %OPT% -I../../../ -I%CATCH_INCLUDE% -o Test.exe ../../Test/Test.cpp ../../Test/TestArithmetic.cpp ../../Test/TestAtomic.cpp ../../Test/TestCalculus.cpp ../../Test/TestChrono.cpp ../../Test/TestColumnFile.cpp ../../Test/TestComparison.cpp ../../Test/TestCompile.cpp ../../Test/TestCompressed.cpp ../../Test/TestCsv.cpp ../../Test/TestDimensions.cpp ../../Test/TestDual.cpp ../../Test/TestFunction.cpp ../../Test/TestInterval.cpp ../../Test/TestIoFwd.cpp ../../Test/TestLiterals.cpp ../../Test/TestLogger.cpp ../../Test/TestLookup.cpp ../../Test/TestMatrix.cpp ../../Test/TestMeasurement.cpp ../../Test/TestOutput.cpp ../../Test/TestPacked.cpp ../../Test/TestPolynomial.cpp ../../Test/TestPrefix.cpp ../../Test/TestRing.cpp ../../Test/TestSharded.cpp ../../Test/TestUnit.cpp ../../Test/TestUnitLiteral.cpp ../../Test/TestUnitParser.cpp ../../Test/TestVector.cpp && Test
 endlocal & goto :EOF
 
 :CATCH_ERROR